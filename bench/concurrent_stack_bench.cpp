@@ -0,0 +1,71 @@
+// Пропускная способность стеков под нагрузкой: make bench && ./bin/concurrent_stack_bench [ops] [threads]
+// Каждый поток выполняет ops пар Push/Pop; число потоков растёт от 1 до threads.
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "stack.hpp"
+#include "concurrent_stack.hpp"
+#include "elimination_stack.hpp"
+
+// ArrayStack под одним мьютексом — то, что заменяет ConcurrentStack
+class LockedStack {
+public:
+    void Push(int item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        stack.Push(item);
+    }
+    bool TryPop(int& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stack.IsEmpty()) return false;
+        out = stack.Pop();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    ArrayStack<int> stack;
+};
+
+template <class S>
+double Run(S& stack, int threads, int ops) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&stack, ops, t] {
+            int value;
+            for (int i = 0; i < ops; ++i) {
+                stack.Push(t + i);
+                stack.TryPop(value);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    auto finish = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(finish - start).count();
+    return 2.0 * threads * ops / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+    int ops = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int maxThreads = argc > 2 ? std::atoi(argv[2])
+                              : std::max(4, static_cast<int>(std::thread::hardware_concurrency()));
+
+    std::cout << "threads  mutex ArrayStack, Mops/s  ConcurrentStack, Mops/s  EliminationStack, Mops/s\n";
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        LockedStack locked;
+        ConcurrentStack<int> lockFree;
+        EliminationStack<int> elimination;
+        double lockedRate = Run(locked, threads, ops);
+        double lockFreeRate = Run(lockFree, threads, ops);
+        double eliminationRate = Run(elimination, threads, ops);
+        std::cout << threads << "  " << lockedRate << "  " << lockFreeRate
+                  << " (x" << lockFreeRate / lockedRate << ")  " << eliminationRate
+                  << " (x" << eliminationRate / lockedRate << ")\n";
+    }
+}
@@ -0,0 +1,83 @@
+// Масштабирование по числу производителей и потребителей:
+// make bench && ./bin/mpmc_queue_bench [items] [max threads per side]
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "queue.hpp"
+#include "mpmc_queue.hpp"
+
+// ArrayQueue под мьютексом — то, что заменяет MpmcQueue
+class LockedQueue {
+public:
+    bool TryEnqueue(int item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.Enqueue(item);
+        return true;
+    }
+    bool TryDequeue(int& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.IsEmpty()) return false;
+        out = queue.Dequeue();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    ArrayQueue<int> queue;
+};
+
+// Mops/s при передаче items элементов от producers потоков к consumers потокам
+template <class Q>
+double Run(Q& queue, int producers, int consumers, int items) {
+    std::atomic<int> consumed{0};
+    std::atomic<long long> checksum{0};
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p, producers, items] {
+            for (int i = p; i < items; i += producers)
+                while (!queue.TryEnqueue(i)) std::this_thread::yield();
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&queue, &consumed, &checksum, items] {
+            long long sum = 0;
+            int value;
+            while (consumed.load(std::memory_order_relaxed) < items) {
+                if (queue.TryDequeue(value)) {
+                    sum += value;
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            checksum.fetch_add(sum);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    auto finish = std::chrono::steady_clock::now();
+    if (checksum.load() != static_cast<long long>(items) * (items - 1) / 2) std::cout << "  CHECKSUM MISMATCH\n";
+    return items / std::chrono::duration<double>(finish - start).count() / 1e6;
+}
+
+int main(int argc, char** argv) {
+    int items = argc > 1 ? std::atoi(argv[1]) : 4000000;
+    int maxThreads = argc > 2 ? std::atoi(argv[2]) : 4;
+
+    std::cout << "producers x consumers  mutex ArrayQueue, Mops/s  MpmcQueue, Mops/s\n";
+    for (int producers = 1; producers <= maxThreads; producers *= 2) {
+        for (int consumers = 1; consumers <= maxThreads; consumers *= 2) {
+            LockedQueue locked;
+            MpmcQueue<int> lockFree(4096);
+            double lockedRate = Run(locked, producers, consumers, items);
+            double lockFreeRate = Run(lockFree, producers, consumers, items);
+            std::cout << producers << " x " << consumers << "  " << lockedRate << "  " << lockFreeRate
+                      << " (x" << lockFreeRate / lockedRate << ")\n";
+        }
+    }
+}
@@ -0,0 +1,91 @@
+// Сравнение сортировок на больших массивах: make bench && ./bin/sort_bench [n]
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dynamic_array.hpp"
+#include "sort.hpp"
+#include "radix_sort.hpp"
+#include "string_sort.hpp"
+#include "user.hpp"
+
+template <class F>
+double Measure(F&& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+template <class T>
+void Report(const std::string& title, const std::vector<T>& source) {
+    int n = static_cast<int>(source.size());
+    DynamicArray<T> intro(n), radix(n), scratch(n);
+    std::vector<T> standard(source);
+    std::copy(source.begin(), source.end(), intro.GetData());
+    std::copy(source.begin(), source.end(), radix.GetData());
+
+    double introMs = Measure([&] { Sorting::IntroSort(intro.GetData(), n, std::less<T>()); });
+    double stdMs = Measure([&] { std::sort(standard.begin(), standard.end()); });
+    double radixMs = Measure([&] { Sorting::RadixSort(radix.GetData(), scratch.GetData(), n); });
+
+    std::cout << title << ": introsort " << introMs << " ms, std::sort " << stdMs
+              << " ms, radix " << radixMs << " ms (x" << introMs / radixMs << ")"
+              << (Sorting::IsSorted(radix.GetData(), n, std::less<T>()) && intro == radix ? "" : "  MISMATCH") << "\n";
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    std::mt19937_64 rng(42);
+
+    std::vector<int> ints(n);
+    for (int& x : ints) x = static_cast<int>(rng());
+    Report("int", ints);
+
+    std::vector<double> doubles(n);
+    std::uniform_real_distribution<double> real(-1e6, 1e6);
+    for (double& x : doubles) x = real(rng);
+    Report("double", doubles);
+
+    int records = n / 10;
+    DynamicArray<Student> byCompare(records), byRadix(records), studentScratch(records);
+    for (int i = 0; i < records; ++i) {
+        Student s("student" + std::to_string(i), 20, static_cast<int>(rng() % 1000000), "G", (rng() % 501) / 100.0);
+        byCompare[i] = s;
+        byRadix[i] = s;
+    }
+    double compareMs = Measure([&] {
+        Sorting::MergeSort(byCompare.GetData(), records, [](const Student& a, const Student& b) { return a.id < b.id; });
+    });
+    double radixMs = Measure([&] { Sorting::RadixSortBy(byRadix.GetData(), studentScratch.GetData(), records, UserKeys::Id); });
+    std::cout << "Student by id (" << records << "): stable sort " << compareMs
+              << " ms, radix " << radixMs << " ms (x" << compareMs / radixMs << ")\n";
+
+    // Строки с длинными общими префиксами, как у адресов или групп.
+    // Каждый алгоритм получает свою свежую копию с тем же порядком размещения в куче.
+    std::vector<std::string> words(records);
+    for (std::string& word : words)
+        word = "university/faculty-" + std::to_string(rng() % 8) + "/group-" + std::to_string(rng() % 1000000);
+    auto sortStrings = [&words, records](bool multikey, DynamicArray<std::string>& out) {
+        DynamicArray<std::string> strings(records), scratch(records);
+        for (int i = 0; i < records; ++i) strings[i] = words[i];
+        double ms = Measure([&] {
+            if (multikey) Sorting::StringSort(strings.GetData(), scratch.GetData(), records);
+            else Sorting::IntroSort(strings.GetData(), records, std::less<std::string>());
+        });
+        std::copy(strings.GetData(), strings.GetData() + records, out.GetData());
+        return ms;
+    };
+    DynamicArray<std::string> introStrings(records), multikeyStrings(records);
+    double introStringMs = sortStrings(false, introStrings);
+    double multikeyMs = sortStrings(true, multikeyStrings);
+    std::cout << "string (" << records << "): introsort " << introStringMs << " ms, multikey "
+              << multikeyMs << " ms (x" << introStringMs / multikeyMs << ")"
+              << (introStrings == multikeyStrings ? "" : "  MISMATCH") << "\n";
+    return 0;
+}
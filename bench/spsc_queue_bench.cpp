@@ -0,0 +1,107 @@
+// Передача элементов между двумя потоками: make bench && ./bin/spsc_queue_bench [n] [batch]
+// Производитель отправляет n чисел, потребитель проверяет порядок.
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "queue.hpp"
+#include "spsc_queue.hpp"
+
+// ArrayQueue под мьютексом — то, что заменяет SpscQueue
+class LockedQueue {
+public:
+    bool TryEnqueue(int item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.Enqueue(item);
+        return true;
+    }
+    bool TryDequeue(int& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.IsEmpty()) return false;
+        out = queue.Dequeue();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    ArrayQueue<int> queue;
+};
+
+template <class Send, class Receive>
+double Run(int n, Send send, Receive receive) {
+    bool ordered = true;
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&] { send(n); });
+    int expected = 0;
+    while (expected < n) {
+        int received = receive(expected, ordered);
+        if (received == 0) std::this_thread::yield();
+        expected += received;
+    }
+    producer.join();
+    auto finish = std::chrono::steady_clock::now();
+    if (!ordered) std::cout << "  ORDER MISMATCH\n";
+    return n / std::chrono::duration<double>(finish - start).count() / 1e6;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 20000000;
+    int batch = argc > 2 ? std::atoi(argv[2]) : 64;
+
+    LockedQueue locked;
+    double lockedRate = Run(n,
+        [&locked](int count) {
+            for (int i = 0; i < count; ++i) locked.TryEnqueue(i);
+        },
+        [&locked](int expected, bool& ordered) {
+            int value;
+            if (!locked.TryDequeue(value)) return 0;
+            ordered = ordered && value == expected;
+            return 1;
+        });
+
+    SpscQueue<int> single(4096);
+    double singleRate = Run(n,
+        [&single](int count) {
+            for (int i = 0; i < count; ++i)
+                while (!single.TryEnqueue(i)) std::this_thread::yield();
+        },
+        [&single](int expected, bool& ordered) {
+            int value;
+            if (!single.TryDequeue(value)) return 0;
+            ordered = ordered && value == expected;
+            return 1;
+        });
+
+    SpscQueue<int> batched(4096);
+    double batchedRate = Run(n,
+        [&batched, batch](int count) {
+            std::vector<int> items(batch);
+            for (int i = 0; i < count;) {
+                int size = std::min(batch, count - i);
+                for (int j = 0; j < size; ++j) items[j] = i + j;
+                for (int sent = 0; sent < size;) {
+                    int pushed = batched.EnqueueN(items.data() + sent, size - sent);
+                    if (pushed == 0) std::this_thread::yield();
+                    sent += pushed;
+                }
+                i += size;
+            }
+        },
+        [&batched, batch](int expected, bool& ordered) {
+            static thread_local std::vector<int> out;
+            out.resize(batch);
+            int received = batched.DequeueN(out.data(), batch);
+            for (int j = 0; j < received; ++j) ordered = ordered && out[j] == expected + j;
+            return received;
+        });
+
+    std::cout << "mutex ArrayQueue: " << lockedRate << " Mops/s\n"
+              << "SpscQueue: " << singleRate << " Mops/s (x" << singleRate / lockedRate << ")\n"
+              << "SpscQueue, batch " << batch << ": " << batchedRate << " Mops/s (x"
+              << batchedRate / lockedRate << ")\n";
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "stack.hpp"
+#include "dynamic_array.hpp"
+#include "errors.hpp"
+
+// Ассоциативные операции для AggregateStack. Своя операция — шаблон с
+// функцией Combine(accumulated, item), результат которой имеет тип T.
+namespace AggregateOps {
+    template <class T>
+    struct Min {
+        static T Combine(const T& accumulated, const T& item) { return item < accumulated ? item : accumulated; }
+    };
+
+    template <class T>
+    struct Max {
+        static T Combine(const T& accumulated, const T& item) { return accumulated < item ? item : accumulated; }
+    };
+
+    template <class T>
+    struct Sum {
+        static T Combine(const T& accumulated, const T& item) { return accumulated + item; }
+    };
+}
+
+// Стек, который рядом с каждым элементом хранит агрегаты всех элементов от дна
+// до него включительно — по одному на каждую операцию из Ops. Агрегат всего
+// стека лежит у вершины, поэтому Aggregate, Min, Max и Sum — O(1) без проходов,
+// а Pop просто открывает агрегаты предыдущего элемента.
+template <class T, template <class> class... Ops>
+class AggregateStack : public Stack<T> {
+    static_assert(sizeof...(Ops) > 0, "AggregateStack needs at least one operation");
+
+private:
+    struct Entry {
+        T value;
+        std::tuple<decltype(Ops<T>::Combine(std::declval<const T&>(), std::declval<const T&>()))...> aggregates;
+    };
+
+    DynamicArray<Entry>* entries;
+
+    // Номер операции Op в списке Ops или sizeof...(Ops), если её нет
+    template <template <class> class Op>
+    static constexpr std::size_t IndexOf();
+
+    template <std::size_t... I>
+    void PushEntry(const T& item, std::index_sequence<I...>);
+
+    const Entry& TopEntry() const;
+
+public:
+    AggregateStack();
+    AggregateStack(T* items, int count);
+    AggregateStack(const AggregateStack& other);
+    AggregateStack& operator=(AggregateStack other);
+    ~AggregateStack() override;
+
+    void Push(const T& item) override;
+    T Pop() override;
+    T Top() const override;
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+
+    int GetLength() const override;
+    bool IsEmpty() const override;
+
+    void Clear() override;
+
+    // Агрегат всего содержимого по операции Op из Ops
+    template <template <class> class Op>
+    T Aggregate() const;
+
+    T Min() const { return Aggregate<AggregateOps::Min>(); }
+    T Max() const { return Aggregate<AggregateOps::Max>(); }
+    T Sum() const { return Aggregate<AggregateOps::Sum>(); }
+};
+
+template <class T, template <class> class... Ops>
+template <template <class> class Op>
+constexpr std::size_t AggregateStack<T, Ops...>::IndexOf() {
+    constexpr bool matches[] = {std::is_same_v<Op<T>, Ops<T>>...};
+    std::size_t index = 0;
+    while (index < sizeof...(Ops) && !matches[index]) ++index;
+    return index;
+}
+
+template <class T, template <class> class... Ops>
+AggregateStack<T, Ops...>::AggregateStack() : entries(new DynamicArray<Entry>(0)) {}
+
+template <class T, template <class> class... Ops>
+AggregateStack<T, Ops...>::AggregateStack(T* items, int count) : AggregateStack() {
+    if (count < 0) throw Errors::NegativeCount();
+    for (int i = 0; i < count; ++i) Push(items[i]);
+}
+
+template <class T, template <class> class... Ops>
+AggregateStack<T, Ops...>::AggregateStack(const AggregateStack& other)
+    : entries(new DynamicArray<Entry>(*other.entries)) {}
+
+template <class T, template <class> class... Ops>
+AggregateStack<T, Ops...>& AggregateStack<T, Ops...>::operator=(AggregateStack other) {
+    std::swap(entries, other.entries);
+    return *this;
+}
+
+template <class T, template <class> class... Ops>
+AggregateStack<T, Ops...>::~AggregateStack() {
+    delete entries;
+}
+
+template <class T, template <class> class... Ops>
+template <std::size_t... I>
+void AggregateStack<T, Ops...>::PushEntry(const T& item, std::index_sequence<I...>) {
+    Entry entry{item, {}};
+    if (entries->GetSize() == 0) {
+        ((std::get<I>(entry.aggregates) = item), ...);
+    } else {
+        const Entry& below = entries->Back();
+        ((std::get<I>(entry.aggregates) = Ops<T>::Combine(std::get<I>(below.aggregates), item)), ...);
+    }
+    entries->PushBack(entry);
+}
+
+template <class T, template <class> class... Ops>
+const typename AggregateStack<T, Ops...>::Entry& AggregateStack<T, Ops...>::TopEntry() const {
+    if (entries->GetSize() == 0) throw Errors::EmptyStackError();
+    return entries->GetData()[entries->GetSize() - 1];
+}
+
+template <class T, template <class> class... Ops>
+void AggregateStack<T, Ops...>::Push(const T& item) {
+    PushEntry(item, std::index_sequence_for<Ops<T>...>());
+}
+
+template <class T, template <class> class... Ops>
+T AggregateStack<T, Ops...>::Pop() {
+    if (entries->GetSize() == 0) throw Errors::EmptyStackError();
+    return entries->PopBack().value;
+}
+
+template <class T, template <class> class... Ops>
+T AggregateStack<T, Ops...>::Top() const {
+    return TopEntry().value;
+}
+
+template <class T, template <class> class... Ops>
+T AggregateStack<T, Ops...>::GetFirst() const {
+    if (entries->GetSize() == 0) throw Errors::EmptyStackError();
+    return entries->GetData()[0].value;
+}
+
+template <class T, template <class> class... Ops>
+T AggregateStack<T, Ops...>::GetLast() const {
+    return Top();
+}
+
+template <class T, template <class> class... Ops>
+T AggregateStack<T, Ops...>::Get(int index) const {
+    if (index < 0 || index >= entries->GetSize()) throw Errors::IndexOutOfRange();
+    return entries->GetData()[index].value;
+}
+
+template <class T, template <class> class... Ops>
+int AggregateStack<T, Ops...>::GetLength() const {
+    return entries->GetSize();
+}
+
+template <class T, template <class> class... Ops>
+bool AggregateStack<T, Ops...>::IsEmpty() const {
+    return entries->GetSize() == 0;
+}
+
+template <class T, template <class> class... Ops>
+void AggregateStack<T, Ops...>::Clear() {
+    entries->Clear();
+}
+
+template <class T, template <class> class... Ops>
+template <template <class> class Op>
+T AggregateStack<T, Ops...>::Aggregate() const {
+    constexpr std::size_t index = IndexOf<Op>();
+    static_assert(index < sizeof...(Ops), "Operation is not tracked by this AggregateStack");
+    return std::get<index>(TopEntry().aggregates);
+}
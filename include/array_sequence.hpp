@@ -2,18 +2,37 @@
 
 #include "sequence.hpp"
 #include "dynamic_array.hpp"
+#include "static_sequence.hpp"
 #include "errors.hpp"
+#include "sort.hpp"
+#include "radix_sort.hpp"
+#include "string_sort.hpp"
+#include <functional>
 #include <stdexcept>
+#include <type_traits>
 
 // Изменяемая версия — базовый класс
 template <typename T>
 class MutableArraySequence : public Sequence<T> {
+    template <typename> friend class MutableArraySequence;
+
 protected:
     DynamicArray<T>* items;
+    // Буферы поразрядной и строковой сортировок: растут только вверх и живут между вызовами
+    DynamicArray<T>* scratch = nullptr;
+    Sorting::RadixKeyBuffer keyScratch;
+
+    T* Scratch(int count);
+
+    // Забирает владение готовым массивом без копирования
+    explicit MutableArraySequence(DynamicArray<T>* ownedItems);
 
     Sequence<T>* CreateFromArray(DynamicArray<T>* array) const;
 
 public:
+    template <class F>
+    using MapResult = std::decay_t<std::invoke_result_t<F&, const T&>>;
+
     MutableArraySequence();
     MutableArraySequence(T* arr, int count);
     MutableArraySequence(const MutableArraySequence<T>& other);
@@ -24,6 +43,8 @@ public:
     T GetLast() const override;
     T Get(int index) const override;
     int GetLength() const override;
+    void CopyTo(T* out, int start, int count) const override;
+    void VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const override;
 
     Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
     Sequence<T>* Concat(const Sequence<T>* other) const override;
@@ -35,6 +56,47 @@ public:
 
     Sequence<T>* Instance() override;
     Sequence<T>* Clone() const override;
+
+    // Статическое представление: доступ без виртуальных вызовов
+    ArraySequenceView<T> View() const;
+
+    // Преобразования принимают любые вызываемые объекты и возвращают новую последовательность
+    template <class F>
+    auto Map(F&& func) const -> MutableArraySequence<MapResult<F>>;
+    template <class P>
+    MutableArraySequence<T> Where(P&& predicate) const;
+    template <class F>
+    T Reduce(F&& func) const;
+    template <class A, class F>
+    A Reduce(F&& func, A init) const;
+
+    // Сортировка на месте: Sort — интроспективная, StableSort — устойчивая слиянием
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare());
+    template <class Compare = std::less<T>>
+    void StableSort(Compare cmp = Compare());
+    template <class Compare = std::less<T>>
+    bool IsSorted(Compare cmp = Compare()) const;
+
+    // Операции над отсортированной последовательностью (двоичный поиск)
+    template <class Compare = std::less<T>>
+    int LowerBound(const T& item, Compare cmp = Compare()) const;
+    template <class Compare = std::less<T>>
+    int UpperBound(const T& item, Compare cmp = Compare()) const;
+    template <class Compare = std::less<T>>
+    int BinarySearch(const T& item, Compare cmp = Compare()) const;
+    template <class Compare = std::less<T>>
+    int SortedInsert(const T& item, Compare cmp = Compare());
+
+    // Поразрядная устойчивая сортировка для числовых T или записей с числовым ключом
+    void RadixSort();
+    template <class KeyOf>
+    void RadixSortBy(KeyOf keyOf);
+
+    // Сортировка строк без повторного сравнения общих префиксов
+    void StringSort();
+    template <class KeyOf>
+    void StringSortBy(KeyOf keyOf);
 };
 
 template <typename T>
@@ -42,6 +104,9 @@ MutableArraySequence<T>::MutableArraySequence() {
     items = new DynamicArray<T>(0);
 }
 
+template <typename T>
+MutableArraySequence<T>::MutableArraySequence(DynamicArray<T>* ownedItems) : items(ownedItems) {}
+
 template <typename T>
 MutableArraySequence<T>::MutableArraySequence(T* arr, int count) {
     items = new DynamicArray<T>(arr, count);
@@ -60,23 +125,22 @@ MutableArraySequence<T>::MutableArraySequence(const DynamicArray<T>& array) {
 template <typename T>
 MutableArraySequence<T>::~MutableArraySequence() {
     delete items;
+    delete scratch;
 }
 
 template <typename T>
 T MutableArraySequence<T>::GetFirst() const {
-    if (GetLength() == 0) throw Errors::EmptyArray();
-    return items->Get(0);
+    return View().GetFirst();
 }
 
 template <typename T>
 T MutableArraySequence<T>::GetLast() const {
-    if (GetLength() == 0) throw Errors::EmptyArray();
-    return items->Get(GetLength() - 1);
+    return View().GetLast();
 }
 
 template <typename T>
 T MutableArraySequence<T>::Get(int index) const {
-    return items->Get(index);
+    return View().Get(index);
 }
 
 template <typename T>
@@ -84,6 +148,18 @@ int MutableArraySequence<T>::GetLength() const {
     return items->GetSize();
 }
 
+template <typename T>
+void MutableArraySequence<T>::CopyTo(T* out, int start, int count) const {
+    items->CopyTo(out, start, count);
+}
+
+// Весь массив — один кусок
+template <typename T>
+void MutableArraySequence<T>::VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const {
+    if (items->GetSize() > 0)
+        visit(context, items->GetData(), items->GetSize());
+}
+
 template <typename T>
 Sequence<T>* MutableArraySequence<T>::GetSubsequence(int startIndex, int endIndex) const {
     DynamicArray<T>* sub = items->GetSubArray(startIndex, endIndex);
@@ -98,40 +174,28 @@ Sequence<T>* MutableArraySequence<T>::Concat(const Sequence<T>* other) const {
     if (!otherArray) throw Errors::IncompatibleTypes();
 
     int totalSize = GetLength() + otherArray->GetLength();
-    DynamicArray<T>* result = new DynamicArray<T>(totalSize);
+    DynamicArray<T> result(totalSize);
+    CopyTo(result.GetData(), 0, GetLength());
+    otherArray->CopyTo(result.GetData() + GetLength(), 0, otherArray->GetLength());
 
-    for (int i = 0; i < GetLength(); i++) result->Set(i, items->Get(i));
-    for (int j = 0; j < otherArray->GetLength(); j++) result->Set(j + GetLength(), otherArray->Get(j));
-
-    return CreateFromArray(result);
+    return CreateFromArray(&result);
 }
 
 template <typename T>
 Sequence<T>* MutableArraySequence<T>::Append(T item) {
-    int size = items->GetSize();
-    items->Resize(size + 1);
-    items->Set(size, item);
+    items->PushBack(item);
     return this;
 }
 
 template <typename T>
 Sequence<T>* MutableArraySequence<T>::Prepend(T item) {
-    int size = items->GetSize();
-    items->Resize(size + 1);
-    for (int i = size; i > 0; i--)
-        items->Set(i, items->Get(i - 1));
-    items->Set(0, item);
+    items->Insert(0, item);
     return this;
 }
 
 template <typename T>
 Sequence<T>* MutableArraySequence<T>::InsertAt(T item, int index) {
-    int size = items->GetSize();
-    if (index < 0 || index > size) throw Errors::IndexOutOfRange();
-    items->Resize(size + 1);
-    for (int i = size; i > index; i--)
-        items->Set(i, items->Get(i - 1));
-    items->Set(index, item);
+    items->Insert(index, item);
     return this;
 }
 
@@ -152,6 +216,139 @@ Sequence<T>* MutableArraySequence<T>::Clone() const {
     return new MutableArraySequence<T>(*this);
 }
 
+template <typename T>
+ArraySequenceView<T> MutableArraySequence<T>::View() const {
+    return ArraySequenceView<T>(*items);
+}
+
+template <typename T>
+template <class F>
+auto MutableArraySequence<T>::Map(F&& func) const -> MutableArraySequence<MapResult<F>> {
+    using U = MapResult<F>;
+    int length = items->GetSize();
+    auto* result = new DynamicArray<U>(length);
+    const T* source = items->GetData();
+    U* target = result->GetData();
+    for (int i = 0; i < length; ++i)
+        target[i] = func(source[i]);
+    return MutableArraySequence<U>(result);
+}
+
+template <typename T>
+template <class P>
+MutableArraySequence<T> MutableArraySequence<T>::Where(P&& predicate) const {
+    int length = items->GetSize();
+    auto* result = new DynamicArray<T>(length);
+    const T* source = items->GetData();
+    T* target = result->GetData();
+    int count = 0;
+    for (int i = 0; i < length; ++i)
+        if (Keeps(predicate, source[i])) target[count++] = source[i];
+    result->Resize(count);
+    return MutableArraySequence<T>(result);
+}
+
+template <typename T>
+template <class F>
+T MutableArraySequence<T>::Reduce(F&& func) const {
+    int length = items->GetSize();
+    if (length == 0) throw Errors::EmptyArray();
+    const T* source = items->GetData();
+    T result = source[0];
+    for (int i = 1; i < length; ++i)
+        result = func(result, source[i]);
+    return result;
+}
+
+template <typename T>
+template <class A, class F>
+A MutableArraySequence<T>::Reduce(F&& func, A init) const {
+    int length = items->GetSize();
+    const T* source = items->GetData();
+    for (int i = 0; i < length; ++i)
+        init = func(init, source[i]);
+    return init;
+}
+
+template <typename T>
+template <class Compare>
+void MutableArraySequence<T>::Sort(Compare cmp) {
+    Sorting::IntroSort(items->GetData(), items->GetSize(), cmp);
+}
+
+template <typename T>
+template <class Compare>
+void MutableArraySequence<T>::StableSort(Compare cmp) {
+    Sorting::MergeSort(items->GetData(), items->GetSize(), cmp);
+}
+
+template <typename T>
+template <class Compare>
+bool MutableArraySequence<T>::IsSorted(Compare cmp) const {
+    return Sorting::IsSorted(items->GetData(), items->GetSize(), cmp);
+}
+
+template <typename T>
+template <class Compare>
+int MutableArraySequence<T>::LowerBound(const T& item, Compare cmp) const {
+    return Sorting::LowerBound(items->GetData(), items->GetSize(), item, cmp);
+}
+
+template <typename T>
+template <class Compare>
+int MutableArraySequence<T>::UpperBound(const T& item, Compare cmp) const {
+    return Sorting::UpperBound(items->GetData(), items->GetSize(), item, cmp);
+}
+
+// Индекс первого элемента, равного item в смысле cmp, или -1
+template <typename T>
+template <class Compare>
+int MutableArraySequence<T>::BinarySearch(const T& item, Compare cmp) const {
+    int index = LowerBound(item, cmp);
+    if (index < items->GetSize() && !cmp(item, items->GetData()[index])) return index;
+    return -1;
+}
+
+// Вставка после равных элементов сохраняет порядок их добавления; возвращает позицию
+template <typename T>
+template <class Compare>
+int MutableArraySequence<T>::SortedInsert(const T& item, Compare cmp) {
+    int index = UpperBound(item, cmp);
+    items->Insert(index, item);
+    return index;
+}
+
+template <typename T>
+T* MutableArraySequence<T>::Scratch(int count) {
+    if (scratch == nullptr)
+        scratch = new DynamicArray<T>(count);
+    else if (scratch->GetSize() < count)
+        scratch->Resize(count);
+    return scratch->GetData();
+}
+
+template <typename T>
+void MutableArraySequence<T>::RadixSort() {
+    Sorting::RadixSort(items->GetData(), Scratch(items->GetSize()), items->GetSize());
+}
+
+template <typename T>
+template <class KeyOf>
+void MutableArraySequence<T>::RadixSortBy(KeyOf keyOf) {
+    Sorting::RadixSortBy(items->GetData(), Scratch(items->GetSize()), items->GetSize(), keyOf, keyScratch);
+}
+
+template <typename T>
+void MutableArraySequence<T>::StringSort() {
+    Sorting::StringSort(items->GetData(), Scratch(items->GetSize()), items->GetSize());
+}
+
+template <typename T>
+template <class KeyOf>
+void MutableArraySequence<T>::StringSortBy(KeyOf keyOf) {
+    Sorting::StringSortBy(items->GetData(), Scratch(items->GetSize()), items->GetSize(), keyOf);
+}
+
 template <typename T>
 Sequence<T>* MutableArraySequence<T>::CreateFromArray(DynamicArray<T>* array) const {
     return new MutableArraySequence<T>(*array);
@@ -167,8 +364,8 @@ MutableArraySequence<T> operator+(const MutableArraySequence<T>& lhs, const Muta
 }
 
 template <typename T>
-MutableArraySequence<T> operator==(const MutableArraySequence<T>& first, const MutableArraySequence<T>& second) { // надо еще сделать сравнение последовательности со статичным массивом
-    
+bool operator==(const MutableArraySequence<T>& first, const MutableArraySequence<T>& second) { // надо еще сделать сравнение последовательности со статичным массивом
+    return first.View().Equals(second.View());
 }
 
 // Неизменяемая версия
@@ -194,11 +391,8 @@ Sequence<T>* ImmutableArraySequence<T>::Concat(const Sequence<T>* other) const {
 
     int totalSize = this->GetLength() + otherArr->GetLength();
     DynamicArray<T> combined(totalSize);
-
-    for (int i = 0; i < this->GetLength(); ++i)
-        combined.Set(i, this->Get(i));
-    for (int j = 0; j < otherArr->GetLength(); ++j)
-        combined.Set(j + this->GetLength(), otherArr->Get(j));
+    this->CopyTo(combined.GetData(), 0, this->GetLength());
+    otherArr->CopyTo(combined.GetData() + this->GetLength(), 0, otherArr->GetLength());
 
     return new ImmutableArraySequence<T>(combined);
 }
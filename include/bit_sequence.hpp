@@ -0,0 +1,375 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "sequence.hpp"
+#include "array_sequence.hpp"
+#include "dynamic_array.hpp"
+#include "errors.hpp"
+
+// Последовательность флагов, упакованных по 64 в машинное слово.
+// Массовые операции (Count, And/Or/Xor, FindFirst, Where) работают целыми
+// словами через popcount/ctz. Биты за пределами length в последнем слове
+// всегда нулевые — на этом держатся Count и FindFirst.
+class BitSequence : public Sequence<bool> {
+private:
+    using Word = std::uint64_t;
+    static constexpr int WordBits = 64;
+    static constexpr int ChunkSize = 256;
+
+    DynamicArray<Word>* words;
+    int length;
+
+    static int WordCount(int bits) { return (bits + WordBits - 1) / WordBits; }
+    static Word LowMask(int bits) { return bits >= WordBits ? ~Word(0) : (Word(1) << bits) - 1; }
+
+    Word* Data() { return words->GetData(); }
+    const Word* Data() const { return words->GetData(); }
+    void Reserve(int bits);
+    void ClearTail();
+    Word ExtractWord(int start) const;
+    void AppendBits(Word bits, int count);
+
+    template <class Op>
+    BitSequence Combine(const BitSequence& other, Op op) const;
+
+public:
+    BitSequence();
+    explicit BitSequence(int length, bool value = false);
+    BitSequence(const bool* items, int count);
+    BitSequence(const BitSequence& other);
+    BitSequence& operator=(BitSequence other);
+    ~BitSequence() override;
+
+    bool GetFirst() const override;
+    bool GetLast() const override;
+    bool Get(int index) const override;
+    int GetLength() const override;
+    void CopyTo(bool* out, int start, int count) const override;
+    // Слова распаковываются в буфер по ChunkSize флагов
+    void VisitChunks(ChunkVisitor visit, void* context) const override;
+
+    Sequence<bool>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<bool>* Concat(const Sequence<bool>* other) const override;
+
+    Sequence<bool>* Append(bool item) override;
+    Sequence<bool>* Prepend(bool item) override;
+    Sequence<bool>* InsertAt(bool item, int index) override;
+    Sequence<bool>* Remove(int index) override;
+
+    Sequence<bool>* Instance() override;
+    Sequence<bool>* Clone() const override;
+
+    void Set(int index, bool value);
+
+    // Пословные операции
+    int Count() const;
+    BitSequence And(const BitSequence& other) const;
+    BitSequence Or(const BitSequence& other) const;
+    BitSequence Xor(const BitSequence& other) const;
+    BitSequence Not() const;
+    // Индекс первого флага, равного value, начиная с from; -1, если такого нет
+    int FindFirst(bool value = true, int from = 0) const;
+    template <class P>
+    BitSequence Where(P&& predicate) const;
+
+    // Маска как выборка: элементы source на позициях установленных флагов
+    template <class T>
+    MutableArraySequence<T> Select(const Sequence<T>& source) const;
+    // Маска predicate(item) по элементам source
+    template <class T, class P>
+    static BitSequence Mask(const Sequence<T>& source, P&& predicate);
+};
+
+
+inline BitSequence::BitSequence() : words(new DynamicArray<Word>(0)), length(0) {}
+
+inline BitSequence::BitSequence(int length, bool value) : BitSequence() {
+    if (length < 0) throw Errors::NegativeSize();
+    Reserve(length);
+    std::fill(Data(), Data() + WordCount(length), value ? ~Word(0) : Word(0));
+    this->length = length;
+    ClearTail();
+}
+
+inline BitSequence::BitSequence(const bool* items, int count) : BitSequence() {
+    if (count < 0) throw Errors::NegativeSize();
+    Reserve(count);
+    for (int i = 0; i < count; i += WordBits) {
+        int n = std::min(WordBits, count - i);
+        Word bits = 0;
+        for (int j = 0; j < n; ++j)
+            bits |= Word(items[i + j]) << j;
+        AppendBits(bits, n);
+    }
+}
+
+inline BitSequence::BitSequence(const BitSequence& other)
+    : words(new DynamicArray<Word>(*other.words)), length(other.length) {}
+
+inline BitSequence& BitSequence::operator=(BitSequence other) {
+    std::swap(words, other.words);
+    std::swap(length, other.length);
+    return *this;
+}
+
+inline BitSequence::~BitSequence() {
+    delete words;
+}
+
+// Слова растут с запасом, новые слова обнуляются
+inline void BitSequence::Reserve(int bits) {
+    int needed = WordCount(bits);
+    int current = words->GetSize();
+    if (needed <= current) return;
+    if (needed > words->GetCapacity())
+        words->EnsureCapacity(std::max(needed, words->GetCapacity() * 2));
+    words->Resize(needed);
+    std::fill(Data() + current, Data() + needed, Word(0));
+}
+
+inline void BitSequence::ClearTail() {
+    int used = WordCount(length);
+    if (length % WordBits != 0)
+        Data()[used - 1] &= LowMask(length % WordBits);
+    words->Resize(used);
+}
+
+// 64 бита, начиная с позиции start (за концом — нули)
+inline BitSequence::Word BitSequence::ExtractWord(int start) const {
+    int index = start / WordBits;
+    int offset = start % WordBits;
+    int count = words->GetSize();
+    Word low = index < count ? Data()[index] >> offset : 0;
+    if (offset == 0 || index + 1 >= count) return low;
+    return low | (Data()[index + 1] << (WordBits - offset));
+}
+
+// Дописывает count младших битов bits
+inline void BitSequence::AppendBits(Word bits, int count) {
+    if (count == 0) return;
+    bits &= LowMask(count);
+    Reserve(length + count);
+    int index = length / WordBits;
+    int offset = length % WordBits;
+    Data()[index] |= bits << offset;
+    if (offset != 0 && offset + count > WordBits)
+        Data()[index + 1] = bits >> (WordBits - offset);
+    length += count;
+}
+
+inline bool BitSequence::GetFirst() const {
+    if (length == 0) throw Errors::EmptyArray();
+    return Get(0);
+}
+
+inline bool BitSequence::GetLast() const {
+    if (length == 0) throw Errors::EmptyArray();
+    return Get(length - 1);
+}
+
+inline bool BitSequence::Get(int index) const {
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    return (Data()[index / WordBits] >> (index % WordBits)) & 1;
+}
+
+inline int BitSequence::GetLength() const {
+    return length;
+}
+
+inline void BitSequence::CopyTo(bool* out, int start, int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    if (start < 0 || start + count > length) throw Errors::InvalidIndices();
+    for (int i = 0; i < count; i += WordBits) {
+        Word bits = ExtractWord(start + i);
+        int n = std::min(WordBits, count - i);
+        for (int j = 0; j < n; ++j)
+            out[i + j] = (bits >> j) & 1;
+    }
+}
+
+inline void BitSequence::VisitChunks(ChunkVisitor visit, void* context) const {
+    bool buffer[ChunkSize];
+    for (int start = 0; start < length; start += ChunkSize) {
+        int n = std::min(ChunkSize, length - start);
+        CopyTo(buffer, start, n);
+        if (!visit(context, buffer, n)) return;
+    }
+}
+
+inline Sequence<bool>* BitSequence::GetSubsequence(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= length || startIndex > endIndex)
+        throw Errors::InvalidIndices();
+    auto* result = new BitSequence();
+    int count = endIndex - startIndex + 1;
+    for (int i = 0; i < count; i += WordBits)
+        result->AppendBits(ExtractWord(startIndex + i), std::min(WordBits, count - i));
+    return result;
+}
+
+inline Sequence<bool>* BitSequence::Concat(const Sequence<bool>* other) const {
+    auto otherBits = dynamic_cast<const BitSequence*>(other);
+    if (!otherBits) throw Errors::IncompatibleTypes();
+    auto* result = new BitSequence(*this);
+    for (int i = 0; i < otherBits->length; i += WordBits)
+        result->AppendBits(otherBits->ExtractWord(i), std::min(WordBits, otherBits->length - i));
+    return result;
+}
+
+inline Sequence<bool>* BitSequence::Append(bool item) {
+    AppendBits(item ? 1 : 0, 1);
+    return this;
+}
+
+inline Sequence<bool>* BitSequence::Prepend(bool item) {
+    return InsertAt(item, 0);
+}
+
+// Биты начиная с index сдвигаются на один вверх с переносом между словами
+inline Sequence<bool>* BitSequence::InsertAt(bool item, int index) {
+    if (index < 0 || index > length) throw Errors::IndexOutOfRange();
+    AppendBits(0, 1);
+    Word* data = Data();
+    int first = index / WordBits;
+    for (int w = words->GetSize() - 1; w > first; --w)
+        data[w] = (data[w] << 1) | (data[w - 1] >> (WordBits - 1));
+    Word low = LowMask(index % WordBits);
+    data[first] = (data[first] & low) | ((data[first] << 1) & ~low);
+    Set(index, item);
+    return this;
+}
+
+inline Sequence<bool>* BitSequence::Remove(int index) {
+    if (length == 0) throw Errors::EmptyArray();
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    Word* data = Data();
+    int first = index / WordBits;
+    int count = words->GetSize();
+    Word low = LowMask(index % WordBits);
+    Word carry = first + 1 < count ? data[first + 1] << (WordBits - 1) : 0;
+    data[first] = (data[first] & low) | ((data[first] >> 1) & ~low) | carry;
+    for (int w = first + 1; w < count; ++w)
+        data[w] = (data[w] >> 1) | (w + 1 < count ? data[w + 1] << (WordBits - 1) : 0);
+    --length;
+    ClearTail();
+    return this;
+}
+
+inline Sequence<bool>* BitSequence::Instance() {
+    return this;
+}
+
+inline Sequence<bool>* BitSequence::Clone() const {
+    return new BitSequence(*this);
+}
+
+inline void BitSequence::Set(int index, bool value) {
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    Word bit = Word(1) << (index % WordBits);
+    if (value) Data()[index / WordBits] |= bit;
+    else Data()[index / WordBits] &= ~bit;
+}
+
+inline int BitSequence::Count() const {
+    int total = 0;
+    for (int i = 0; i < words->GetSize(); ++i)
+        total += __builtin_popcountll(Data()[i]);
+    return total;
+}
+
+template <class Op>
+BitSequence BitSequence::Combine(const BitSequence& other, Op op) const {
+    if (length != other.length) throw Errors::InvalidArgument("bit sequences differ in length");
+    BitSequence result(*this);
+    Word* target = result.Data();
+    const Word* source = other.Data();
+    for (int i = 0; i < result.words->GetSize(); ++i)
+        target[i] = op(target[i], source[i]);
+    return result;
+}
+
+inline BitSequence BitSequence::And(const BitSequence& other) const {
+    return Combine(other, [](Word a, Word b) { return a & b; });
+}
+
+inline BitSequence BitSequence::Or(const BitSequence& other) const {
+    return Combine(other, [](Word a, Word b) { return a | b; });
+}
+
+inline BitSequence BitSequence::Xor(const BitSequence& other) const {
+    return Combine(other, [](Word a, Word b) { return a ^ b; });
+}
+
+inline BitSequence BitSequence::Not() const {
+    BitSequence result(*this);
+    for (int i = 0; i < result.words->GetSize(); ++i)
+        result.Data()[i] = ~result.Data()[i];
+    result.ClearTail();
+    return result;
+}
+
+inline int BitSequence::FindFirst(bool value, int from) const {
+    if (from < 0) throw Errors::IndexOutOfRange();
+    if (from >= length) return -1;
+    int count = words->GetSize();
+    Word flip = value ? 0 : ~Word(0);
+    int index = from / WordBits;
+    Word bits = (Data()[index] ^ flip) & ~LowMask(from % WordBits);
+    while (true) {
+        if (bits != 0) {
+            int position = index * WordBits + __builtin_ctzll(bits);
+            return position < length ? position : -1;
+        }
+        if (++index == count) return -1;
+        bits = Data()[index] ^ flip;
+    }
+}
+
+// Результат зависит только от predicate(true) и predicate(false): считается по Count
+template <class P>
+BitSequence BitSequence::Where(P&& predicate) const {
+    bool keepTrue = predicate(true);
+    bool keepFalse = predicate(false);
+    if (keepTrue && keepFalse) return *this;
+    int ones = Count();
+    if (keepTrue) return BitSequence(ones, true);
+    if (keepFalse) return BitSequence(length - ones, false);
+    return BitSequence();
+}
+
+template <class T>
+MutableArraySequence<T> BitSequence::Select(const Sequence<T>& source) const {
+    if (source.GetLength() != length) throw Errors::InvalidArgument("mask and sequence differ in length");
+    DynamicArray<T> selected(Count());
+    T* target = selected.GetData();
+    int offset = 0;
+    int next = FindFirst(true, 0);
+    source.ForEachChunk([&](const T* chunk, int chunkLength) {
+        int end = offset + chunkLength;
+        while (next != -1 && next < end) {
+            *target++ = chunk[next - offset];
+            next = FindFirst(true, next + 1);
+        }
+        offset = end;
+    });
+    return MutableArraySequence<T>(selected);
+}
+
+template <class T, class P>
+BitSequence BitSequence::Mask(const Sequence<T>& source, P&& predicate) {
+    BitSequence result;
+    result.Reserve(source.GetLength());
+    Word bits = 0;
+    int pending = 0;
+    source.ForEach([&](const T& item) {
+        bits |= Word(predicate(item) ? 1 : 0) << pending;
+        if (++pending == WordBits) {
+            result.AppendBits(bits, pending);
+            bits = 0;
+            pending = 0;
+        }
+    });
+    result.AppendBits(bits, pending);
+    return result;
+}
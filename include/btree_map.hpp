@@ -0,0 +1,591 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "array_sequence.hpp"
+#include "dynamic_array.hpp"
+#include "static_sequence.hpp"
+#include "sort.hpp"
+#include "errors.hpp"
+
+// Упорядоченный ассоциативный массив на B+-дереве.
+// Узлы широкие (ключи занимают около NodeBytes байт подряд), поэтому поиск
+// проходит несколько уровней и внутри узла идёт двоичным поиском по сплошному
+// массиву ключей. Значения хранятся только в листьях, листья связаны в список —
+// упорядоченный обход и диапазоны идут по листьям без возврата наверх.
+template <class K, class V, class Compare = std::less<K>>
+class BTreeMap {
+public:
+    static constexpr int NodeBytes = 256;
+    static constexpr int InnerCapacity = std::max(4, NodeBytes / static_cast<int>(sizeof(K)));
+    static constexpr int LeafCapacity = std::max(4, NodeBytes / static_cast<int>(sizeof(K)));
+
+private:
+    static constexpr int InnerMin = InnerCapacity / 2;
+    static constexpr int LeafMin = LeafCapacity / 2;
+
+    struct Node {
+        bool leaf;
+        int count; // число ключей
+        explicit Node(bool leaf) : leaf(leaf), count(0) {}
+    };
+
+    struct Leaf : Node {
+        K keys[LeafCapacity];
+        V values[LeafCapacity];
+        Leaf* prev = nullptr;
+        Leaf* next = nullptr;
+        Leaf() : Node(true) {}
+    };
+
+    // children[i] содержит ключи < keys[i], children[i + 1] — ключи >= keys[i]
+    struct Inner : Node {
+        K keys[InnerCapacity];
+        Node* children[InnerCapacity + 1];
+        Inner() : Node(false) {}
+    };
+
+    struct Split {
+        K separator;
+        Node* right = nullptr;
+    };
+
+    Node* root;
+    Leaf* first;
+    int size;
+    Compare cmp;
+
+    static void Destroy(Node* node);
+    bool Insert(Node* node, const K& key, const V& value, Split& split);
+    bool Erase(Node* node, const K& key);
+    void FixChild(Inner* parent, int index);
+    bool Underflow(const Node* node) const;
+    const Leaf* FindLeaf(const K& key) const;
+    void Build(const K* keys, const V* values, int count);
+
+public:
+    class ConstIterator {
+    private:
+        const Leaf* leaf;
+        int index;
+
+        friend class BTreeMap;
+        ConstIterator(const Leaf* leaf, int index);
+
+    public:
+        const K& Key() const { return leaf->keys[index]; }
+        const V& Value() const { return leaf->values[index]; }
+        const V& operator*() const { return leaf->values[index]; }
+        ConstIterator& operator++();
+        bool operator==(const ConstIterator& other) const { return leaf == other.leaf && index == other.index; }
+        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+    };
+
+    // Диапазон значений [from, to) как статическая последовательность
+    class RangeView : public StaticSequence<RangeView, V> {
+    private:
+        ConstIterator first;
+        ConstIterator last;
+        int length;
+
+    public:
+        RangeView(ConstIterator first, ConstIterator last, int length) : first(first), last(last), length(length) {}
+
+        int Length() const { return length; }
+        const V& At(int index) const {
+            ConstIterator it = first;
+            for (int i = 0; i < index; ++i) ++it;
+            return *it;
+        }
+        ConstIterator begin() const { return first; }
+        ConstIterator end() const { return last; }
+
+        static void ThrowEmpty() { throw Errors::EmptyValue(); }
+    };
+
+    BTreeMap();
+    BTreeMap(const BTreeMap<K, V, Compare>& other);
+    BTreeMap(BTreeMap<K, V, Compare>&& other) noexcept;
+    BTreeMap<K, V, Compare>& operator=(BTreeMap<K, V, Compare> other);
+    ~BTreeMap();
+
+    // Построение за O(n) из последовательности, отсортированной по keyOf.
+    // При равных ключах остаётся последняя запись.
+    template <class KeyOf>
+    static BTreeMap<K, V, Compare> FromSorted(const MutableArraySequence<V>& sorted, KeyOf keyOf);
+
+    void Set(const K& key, const V& value);
+    V Get(const K& key) const;
+    const V* Find(const K& key) const;
+    bool Contains(const K& key) const;
+    bool Remove(const K& key);
+
+    int GetCount() const;
+    bool IsEmpty() const;
+    void Clear();
+
+    ConstIterator begin() const;
+    ConstIterator end() const;
+    ConstIterator LowerBound(const K& key) const;
+    ConstIterator UpperBound(const K& key) const;
+    RangeView Range(const K& from, const K& to) const;
+
+    // func(key, value) в порядке возрастания ключей
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+
+template <class K, class V, class Compare>
+BTreeMap<K, V, Compare>::ConstIterator::ConstIterator(const Leaf* leaf, int index) : leaf(leaf), index(index) {
+    // Позиция за концом листа нормализуется к началу следующего
+    while (this->leaf && this->index == this->leaf->count) {
+        this->leaf = this->leaf->next;
+        this->index = 0;
+    }
+}
+
+template <class K, class V, class Compare>
+typename BTreeMap<K, V, Compare>::ConstIterator& BTreeMap<K, V, Compare>::ConstIterator::operator++() {
+    ++index;
+    while (leaf && index == leaf->count) {
+        leaf = leaf->next;
+        index = 0;
+    }
+    return *this;
+}
+
+
+template <class K, class V, class Compare>
+BTreeMap<K, V, Compare>::BTreeMap() : size(0) {
+    first = new Leaf();
+    root = first;
+}
+
+template <class K, class V, class Compare>
+BTreeMap<K, V, Compare>::BTreeMap(const BTreeMap<K, V, Compare>& other) : root(nullptr), first(nullptr), size(0), cmp(other.cmp) {
+    DynamicArray<K> keys(other.size);
+    DynamicArray<V> values(other.size);
+    int i = 0;
+    for (ConstIterator it = other.begin(); it != other.end(); ++it, ++i) {
+        keys[i] = it.Key();
+        values[i] = it.Value();
+    }
+    Build(keys.GetData(), values.GetData(), other.size);
+}
+
+template <class K, class V, class Compare>
+BTreeMap<K, V, Compare>::BTreeMap(BTreeMap<K, V, Compare>&& other) noexcept
+    : root(other.root), first(other.first), size(other.size), cmp(std::move(other.cmp)) {
+    other.root = nullptr;
+    other.first = nullptr;
+    other.size = 0;
+}
+
+template <class K, class V, class Compare>
+BTreeMap<K, V, Compare>& BTreeMap<K, V, Compare>::operator=(BTreeMap<K, V, Compare> other) {
+    std::swap(root, other.root);
+    std::swap(first, other.first);
+    std::swap(size, other.size);
+    std::swap(cmp, other.cmp);
+    return *this;
+}
+
+template <class K, class V, class Compare>
+BTreeMap<K, V, Compare>::~BTreeMap() {
+    Destroy(root);
+}
+
+template <class K, class V, class Compare>
+void BTreeMap<K, V, Compare>::Destroy(Node* node) {
+    if (!node) return;
+    if (node->leaf) {
+        delete static_cast<Leaf*>(node);
+        return;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    for (int i = 0; i <= inner->count; ++i)
+        Destroy(inner->children[i]);
+    delete inner;
+}
+
+// Листья заполняются равномерно, затем уровни собираются снизу вверх
+template <class K, class V, class Compare>
+void BTreeMap<K, V, Compare>::Build(const K* keys, const V* values, int count) {
+    int leafCount = std::max(1, (count + LeafCapacity - 1) / LeafCapacity);
+    DynamicArray<Node*> level(leafCount);
+    DynamicArray<K> lowKeys(leafCount);
+
+    Leaf* previous = nullptr;
+    int offset = 0;
+    for (int i = 0; i < leafCount; ++i) {
+        Leaf* leaf = new Leaf();
+        leaf->count = count / leafCount + (i < count % leafCount ? 1 : 0);
+        std::copy(keys + offset, keys + offset + leaf->count, leaf->keys);
+        std::copy(values + offset, values + offset + leaf->count, leaf->values);
+        if (leaf->count > 0) lowKeys[i] = leaf->keys[0];
+        offset += leaf->count;
+
+        leaf->prev = previous;
+        if (previous) previous->next = leaf;
+        previous = leaf;
+        level[i] = leaf;
+    }
+    first = static_cast<Leaf*>(level[0]);
+
+    int nodes = leafCount;
+    while (nodes > 1) {
+        int parents = (nodes + InnerCapacity) / (InnerCapacity + 1);
+        int child = 0;
+        for (int i = 0; i < parents; ++i) {
+            Inner* inner = new Inner();
+            int children = nodes / parents + (i < nodes % parents ? 1 : 0);
+            K low = lowKeys[child];
+            for (int j = 0; j < children; ++j, ++child) {
+                inner->children[j] = level[child];
+                if (j > 0) inner->keys[j - 1] = lowKeys[child];
+            }
+            inner->count = children - 1;
+            level[i] = inner;
+            lowKeys[i] = low;
+        }
+        nodes = parents;
+    }
+    root = level[0];
+    size = count;
+}
+
+template <class K, class V, class Compare>
+template <class KeyOf>
+BTreeMap<K, V, Compare> BTreeMap<K, V, Compare>::FromSorted(const MutableArraySequence<V>& sorted, KeyOf keyOf) {
+    BTreeMap<K, V, Compare> result;
+    ArraySequenceView<V> view = sorted.View();
+    int length = view.GetLength();
+    DynamicArray<K> keys(length);
+    DynamicArray<V> values(length);
+
+    int count = 0;
+    for (int i = 0; i < length; ++i) {
+        K key = keyOf(view.At(i));
+        if (count > 0 && result.cmp(key, keys[count - 1]))
+            throw Errors::InvalidArgument("sequence is not sorted by key");
+        if (count > 0 && !result.cmp(keys[count - 1], key)) --count;
+        keys[count] = key;
+        values[count] = view.At(i);
+        ++count;
+    }
+
+    Destroy(result.root);
+    result.Build(keys.GetData(), values.GetData(), count);
+    return result;
+}
+
+template <class K, class V, class Compare>
+const typename BTreeMap<K, V, Compare>::Leaf* BTreeMap<K, V, Compare>::FindLeaf(const K& key) const {
+    const Node* node = root;
+    while (!node->leaf) {
+        const Inner* inner = static_cast<const Inner*>(node);
+        node = inner->children[Sorting::UpperBound(inner->keys, inner->count, key, cmp)];
+    }
+    return static_cast<const Leaf*>(node);
+}
+
+// Возвращает true, если ключ новый; при переполнении узла заполняет split
+template <class K, class V, class Compare>
+bool BTreeMap<K, V, Compare>::Insert(Node* node, const K& key, const V& value, Split& split) {
+    if (node->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int pos = Sorting::LowerBound(leaf->keys, leaf->count, key, cmp);
+        if (pos < leaf->count && !cmp(key, leaf->keys[pos])) {
+            leaf->values[pos] = value;
+            return false;
+        }
+
+        Leaf* target = leaf;
+        if (leaf->count == LeafCapacity) {
+            int half = LeafCapacity / 2;
+            Leaf* right = new Leaf();
+            right->count = LeafCapacity - half;
+            std::move(leaf->keys + half, leaf->keys + LeafCapacity, right->keys);
+            std::move(leaf->values + half, leaf->values + LeafCapacity, right->values);
+            leaf->count = half;
+
+            right->next = leaf->next;
+            if (right->next) right->next->prev = right;
+            right->prev = leaf;
+            leaf->next = right;
+
+            if (pos >= half) {
+                target = right;
+                pos -= half;
+            }
+            split.right = right;
+        }
+
+        std::move_backward(target->keys + pos, target->keys + target->count, target->keys + target->count + 1);
+        std::move_backward(target->values + pos, target->values + target->count, target->values + target->count + 1);
+        target->keys[pos] = key;
+        target->values[pos] = value;
+        ++target->count;
+
+        if (split.right) split.separator = static_cast<Leaf*>(split.right)->keys[0];
+        return true;
+    }
+
+    Inner* inner = static_cast<Inner*>(node);
+    int index = Sorting::UpperBound(inner->keys, inner->count, key, cmp);
+    Split childSplit;
+    bool inserted = Insert(inner->children[index], key, value, childSplit);
+    if (!childSplit.right) return inserted;
+
+    Inner* target = inner;
+    if (inner->count == InnerCapacity) {
+        int mid = InnerCapacity / 2;
+        Inner* right = new Inner();
+        right->count = InnerCapacity - mid - 1;
+        std::move(inner->keys + mid + 1, inner->keys + InnerCapacity, right->keys);
+        std::copy(inner->children + mid + 1, inner->children + InnerCapacity + 1, right->children);
+        split.separator = inner->keys[mid];
+        split.right = right;
+        inner->count = mid;
+
+        if (index > mid) {
+            target = right;
+            index -= mid + 1;
+        }
+    }
+
+    std::move_backward(target->keys + index, target->keys + target->count, target->keys + target->count + 1);
+    std::copy_backward(target->children + index + 1, target->children + target->count + 1, target->children + target->count + 2);
+    target->keys[index] = childSplit.separator;
+    target->children[index + 1] = childSplit.right;
+    ++target->count;
+    return inserted;
+}
+
+template <class K, class V, class Compare>
+void BTreeMap<K, V, Compare>::Set(const K& key, const V& value) {
+    Split split;
+    if (Insert(root, key, value, split)) ++size;
+    if (split.right) {
+        Inner* newRoot = new Inner();
+        newRoot->keys[0] = split.separator;
+        newRoot->children[0] = root;
+        newRoot->children[1] = split.right;
+        newRoot->count = 1;
+        root = newRoot;
+    }
+}
+
+template <class K, class V, class Compare>
+bool BTreeMap<K, V, Compare>::Underflow(const Node* node) const {
+    return node->count < (node->leaf ? LeafMin : InnerMin);
+}
+
+// Дочерний узел index стал меньше минимума: берём ключ у соседа или сливаемся с ним
+template <class K, class V, class Compare>
+void BTreeMap<K, V, Compare>::FixChild(Inner* parent, int index) {
+    Node* child = parent->children[index];
+    Node* leftNode = index > 0 ? parent->children[index - 1] : nullptr;
+    Node* rightNode = index < parent->count ? parent->children[index + 1] : nullptr;
+    int minimum = child->leaf ? LeafMin : InnerMin;
+
+    if (child->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(child);
+        Leaf* left = static_cast<Leaf*>(leftNode);
+        Leaf* right = static_cast<Leaf*>(rightNode);
+        if (left && left->count > minimum) {
+            std::move_backward(leaf->keys, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+            std::move_backward(leaf->values, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+            leaf->keys[0] = std::move(left->keys[left->count - 1]);
+            leaf->values[0] = std::move(left->values[left->count - 1]);
+            --left->count;
+            ++leaf->count;
+            parent->keys[index - 1] = leaf->keys[0];
+            return;
+        }
+        if (right && right->count > minimum) {
+            leaf->keys[leaf->count] = std::move(right->keys[0]);
+            leaf->values[leaf->count] = std::move(right->values[0]);
+            ++leaf->count;
+            std::move(right->keys + 1, right->keys + right->count, right->keys);
+            std::move(right->values + 1, right->values + right->count, right->values);
+            --right->count;
+            parent->keys[index] = right->keys[0];
+            return;
+        }
+        // Слияние правого листа пары в левый
+        if (!left) {
+            left = leaf;
+            ++index;
+        } else {
+            right = leaf;
+        }
+        std::move(right->keys, right->keys + right->count, left->keys + left->count);
+        std::move(right->values, right->values + right->count, left->values + left->count);
+        left->count += right->count;
+        left->next = right->next;
+        if (left->next) left->next->prev = left;
+        delete right;
+    } else {
+        Inner* node = static_cast<Inner*>(child);
+        Inner* left = static_cast<Inner*>(leftNode);
+        Inner* right = static_cast<Inner*>(rightNode);
+        if (left && left->count > minimum) {
+            std::move_backward(node->keys, node->keys + node->count, node->keys + node->count + 1);
+            std::copy_backward(node->children, node->children + node->count + 1, node->children + node->count + 2);
+            node->keys[0] = parent->keys[index - 1];
+            node->children[0] = left->children[left->count];
+            parent->keys[index - 1] = left->keys[left->count - 1];
+            --left->count;
+            ++node->count;
+            return;
+        }
+        if (right && right->count > minimum) {
+            node->keys[node->count] = parent->keys[index];
+            node->children[node->count + 1] = right->children[0];
+            ++node->count;
+            parent->keys[index] = right->keys[0];
+            std::move(right->keys + 1, right->keys + right->count, right->keys);
+            std::copy(right->children + 1, right->children + right->count + 1, right->children);
+            --right->count;
+            return;
+        }
+        if (!left) {
+            left = node;
+            ++index;
+        } else {
+            right = node;
+        }
+        left->keys[left->count] = parent->keys[index - 1];
+        std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+        std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+        left->count += right->count + 1;
+        delete right;
+    }
+
+    // Из родителя уходит разделитель index - 1 и ссылка на правый узел index
+    std::move(parent->keys + index, parent->keys + parent->count, parent->keys + index - 1);
+    std::copy(parent->children + index + 1, parent->children + parent->count + 1, parent->children + index);
+    --parent->count;
+}
+
+template <class K, class V, class Compare>
+bool BTreeMap<K, V, Compare>::Erase(Node* node, const K& key) {
+    if (node->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int pos = Sorting::LowerBound(leaf->keys, leaf->count, key, cmp);
+        if (pos == leaf->count || cmp(key, leaf->keys[pos])) return false;
+        std::move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+        std::move(leaf->values + pos + 1, leaf->values + leaf->count, leaf->values + pos);
+        --leaf->count;
+        return true;
+    }
+
+    Inner* inner = static_cast<Inner*>(node);
+    int index = Sorting::UpperBound(inner->keys, inner->count, key, cmp);
+    if (!Erase(inner->children[index], key)) return false;
+    if (Underflow(inner->children[index])) FixChild(inner, index);
+    return true;
+}
+
+template <class K, class V, class Compare>
+bool BTreeMap<K, V, Compare>::Remove(const K& key) {
+    if (!Erase(root, key)) return false;
+    --size;
+    if (!root->leaf && root->count == 0) {
+        Inner* oldRoot = static_cast<Inner*>(root);
+        root = oldRoot->children[0];
+        delete oldRoot;
+    }
+    return true;
+}
+
+template <class K, class V, class Compare>
+V BTreeMap<K, V, Compare>::Get(const K& key) const {
+    const V* value = Find(key);
+    if (!value) throw Errors::KeyNotFound();
+    return *value;
+}
+
+template <class K, class V, class Compare>
+const V* BTreeMap<K, V, Compare>::Find(const K& key) const {
+    const Leaf* leaf = FindLeaf(key);
+    int pos = Sorting::LowerBound(leaf->keys, leaf->count, key, cmp);
+    if (pos == leaf->count || cmp(key, leaf->keys[pos])) return nullptr;
+    return &leaf->values[pos];
+}
+
+template <class K, class V, class Compare>
+bool BTreeMap<K, V, Compare>::Contains(const K& key) const {
+    return Find(key) != nullptr;
+}
+
+template <class K, class V, class Compare>
+int BTreeMap<K, V, Compare>::GetCount() const {
+    return size;
+}
+
+template <class K, class V, class Compare>
+bool BTreeMap<K, V, Compare>::IsEmpty() const {
+    return size == 0;
+}
+
+template <class K, class V, class Compare>
+void BTreeMap<K, V, Compare>::Clear() {
+    Destroy(root);
+    first = new Leaf();
+    root = first;
+    size = 0;
+}
+
+template <class K, class V, class Compare>
+typename BTreeMap<K, V, Compare>::ConstIterator BTreeMap<K, V, Compare>::begin() const {
+    return ConstIterator(first, 0);
+}
+
+template <class K, class V, class Compare>
+typename BTreeMap<K, V, Compare>::ConstIterator BTreeMap<K, V, Compare>::end() const {
+    return ConstIterator(nullptr, 0);
+}
+
+template <class K, class V, class Compare>
+typename BTreeMap<K, V, Compare>::ConstIterator BTreeMap<K, V, Compare>::LowerBound(const K& key) const {
+    const Leaf* leaf = FindLeaf(key);
+    return ConstIterator(leaf, Sorting::LowerBound(leaf->keys, leaf->count, key, cmp));
+}
+
+template <class K, class V, class Compare>
+typename BTreeMap<K, V, Compare>::ConstIterator BTreeMap<K, V, Compare>::UpperBound(const K& key) const {
+    const Leaf* leaf = FindLeaf(key);
+    return ConstIterator(leaf, Sorting::UpperBound(leaf->keys, leaf->count, key, cmp));
+}
+
+// Длина считается по листьям: O(k / LeafCapacity) шагов вместо O(k)
+template <class K, class V, class Compare>
+typename BTreeMap<K, V, Compare>::RangeView BTreeMap<K, V, Compare>::Range(const K& from, const K& to) const {
+    if (!cmp(from, to)) return RangeView(end(), end(), 0);
+    ConstIterator low = LowerBound(from);
+    ConstIterator high = LowerBound(to);
+
+    int length = 0;
+    const Leaf* leaf = low.leaf;
+    int index = low.index;
+    while (leaf != high.leaf) {
+        length += leaf->count - index;
+        leaf = leaf->next;
+        index = 0;
+    }
+    if (leaf) length += high.index - index;
+    return RangeView(low, high, length);
+}
+
+template <class K, class V, class Compare>
+template <class F>
+void BTreeMap<K, V, Compare>::ForEach(F&& func) const {
+    for (const Leaf* leaf = first; leaf; leaf = leaf->next)
+        for (int i = 0; i < leaf->count; ++i)
+            func(leaf->keys[i], leaf->values[i]);
+}
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "queue.hpp"
+#include "epoch.hpp"
+#include "errors.hpp"
+
+// Неограниченная lock-free очередь Майкла–Скотта: односвязный список узлов,
+// как у LinkedList, с фиктивным узлом в голове. Enqueue подвешивает узел CAS-ом
+// к next последнего и затем сдвигает tail (отставший tail дотягивает любой
+// поток), Dequeue сдвигает head на следующий узел. Снятые узлы проходят через
+// EpochDomain и после льготного периода возвращаются в кэш узлов потока, так
+// что в установившемся режиме очередь не обращается к куче.
+// Enqueue, Dequeue, TryDequeue, Clear, Peek, Get, GetFirst, GetLast, Reduce и
+// GetLength безопасны из любых потоков (чтения — снимок); Map и Where меняют
+// элементы на месте и допустимы, только пока очередью больше никто не пользуется.
+template <class T>
+class ConcurrentQueue : public Queue<T> {
+private:
+    static constexpr int CacheLimit = 256;
+
+    struct Node {
+        T data;
+        std::atomic<Node*> next;
+        Node() : data(), next(nullptr) {}
+    };
+
+    // Кэш свободных узлов потока. Указатель и счётчик тривиальны и доступны
+    // даже после завершения потока; Drain при выходе потока освобождает узлы
+    // и закрывает кэш для узлов, которые EpochDomain отдаст позже.
+    struct NodeCache {
+        static thread_local Node* free;
+        static thread_local int size;
+        static thread_local bool closed;
+
+        struct Drain {
+            ~Drain() {
+                while (free) {
+                    Node* next = free->next.load(std::memory_order_relaxed);
+                    delete free;
+                    free = next;
+                }
+                size = 0;
+                closed = true;
+            }
+        };
+
+        // Регистрирует Drain потока; вызывается на всех путях, где поток берёт
+        // или снимает узлы
+        static void Attach();
+        static Node* Take();
+        static void Put(void* pointer);
+    };
+
+    alignas(64) std::atomic<Node*> head;
+    // Where интерфейса Queue перестраивает список из const-метода
+    alignas(64) mutable std::atomic<Node*> tail;
+    alignas(64) mutable std::atomic<int> count;
+
+public:
+    ConcurrentQueue();
+    ConcurrentQueue(T* items, int count);
+    ConcurrentQueue(const ConcurrentQueue<T>&) = delete;
+    ConcurrentQueue<T>& operator=(const ConcurrentQueue<T>&) = delete;
+    ~ConcurrentQueue() override;
+
+    void Enqueue(const T& item) override;
+    T Dequeue() override;
+    T Peek() const override;
+    // Dequeue без исключения для пустой очереди
+    bool TryDequeue(T& out);
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+
+    int GetLength() const override;
+    bool IsEmpty() const override;
+
+    void Clear() override;
+
+    void Map(void (*func)(T&)) const override;
+    void Where(bool (*func)(T&)) const override;
+    T Reduce(T (*func)(const T&, const T&)) const override;
+};
+
+template <class T>
+thread_local typename ConcurrentQueue<T>::Node* ConcurrentQueue<T>::NodeCache::free = nullptr;
+
+template <class T>
+thread_local int ConcurrentQueue<T>::NodeCache::size = 0;
+
+template <class T>
+thread_local bool ConcurrentQueue<T>::NodeCache::closed = false;
+
+template <class T>
+void ConcurrentQueue<T>::NodeCache::Attach() {
+    static thread_local Drain drain;
+    (void)drain;
+}
+
+template <class T>
+typename ConcurrentQueue<T>::Node* ConcurrentQueue<T>::NodeCache::Take() {
+    Attach();
+    if (!free) return new Node();
+    Node* node = free;
+    free = node->next.load(std::memory_order_relaxed);
+    --size;
+    node->next.store(nullptr, std::memory_order_relaxed);
+    return node;
+}
+
+// Вызывается из EpochDomain, когда узел уже никому не виден
+template <class T>
+void ConcurrentQueue<T>::NodeCache::Put(void* pointer) {
+    Node* node = static_cast<Node*>(pointer);
+    if (closed || size >= CacheLimit) {
+        delete node;
+        return;
+    }
+    if constexpr (!std::is_trivially_destructible_v<T>) node->data = T();
+    node->next.store(free, std::memory_order_relaxed);
+    free = node;
+    ++size;
+}
+
+template <class T>
+ConcurrentQueue<T>::ConcurrentQueue() : count(0) {
+    NodeCache::Attach();
+    Node* dummy = new Node();
+    head.store(dummy, std::memory_order_relaxed);
+    tail.store(dummy, std::memory_order_relaxed);
+}
+
+template <class T>
+ConcurrentQueue<T>::ConcurrentQueue(T* items, int count) : ConcurrentQueue() {
+    if (count < 0) throw Errors::NegativeCount();
+    for (int i = 0; i < count; ++i) Enqueue(items[i]);
+}
+
+// К моменту разрушения других потоков у очереди нет: узлы удаляются сразу
+template <class T>
+ConcurrentQueue<T>::~ConcurrentQueue() {
+    Node* node = head.load(std::memory_order_relaxed);
+    while (node) {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+    }
+}
+
+template <class T>
+void ConcurrentQueue<T>::Enqueue(const T& item) {
+    Node* node = NodeCache::Take();
+    node->data = item;
+    count.fetch_add(1, std::memory_order_relaxed);
+
+    auto guard = EpochDomain::Pin();
+    for (;;) {
+        Node* last = tail.load(std::memory_order_acquire);
+        Node* next = last->next.load(std::memory_order_acquire);
+        if (last != tail.load(std::memory_order_acquire)) continue;
+        if (next) {
+            tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+        Node* expected = nullptr;
+        if (last->next.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed)) {
+            tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+template <class T>
+bool ConcurrentQueue<T>::TryDequeue(T& out) {
+    NodeCache::Attach();
+    auto guard = EpochDomain::Pin();
+    for (;;) {
+        Node* first = head.load(std::memory_order_acquire);
+        Node* last = tail.load(std::memory_order_acquire);
+        Node* next = first->next.load(std::memory_order_acquire);
+        if (first != head.load(std::memory_order_acquire)) continue;
+        if (!next) return false;
+        if (first == last) {
+            tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+        // Копия до CAS: после него next становится фиктивным узлом, но его
+        // данные не меняются, пока узел не пройдёт через EpochDomain
+        T value = next->data;
+        if (head.compare_exchange_weak(first, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            count.fetch_sub(1, std::memory_order_relaxed);
+            EpochDomain::Retire(first, &NodeCache::Put);
+            out = std::move(value);
+            return true;
+        }
+    }
+}
+
+template <class T>
+T ConcurrentQueue<T>::Dequeue() {
+    T item;
+    if (!TryDequeue(item)) throw Errors::EmptyArray();
+    return item;
+}
+
+template <class T>
+T ConcurrentQueue<T>::Peek() const {
+    return GetFirst();
+}
+
+template <class T>
+T ConcurrentQueue<T>::GetFirst() const {
+    auto guard = EpochDomain::Pin();
+    Node* first = head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire);
+    if (!first) throw Errors::EmptyArray();
+    return first->data;
+}
+
+// tail может отставать на узел, поэтому последний ищется по next
+template <class T>
+T ConcurrentQueue<T>::GetLast() const {
+    auto guard = EpochDomain::Pin();
+    Node* node = tail.load(std::memory_order_acquire);
+    if (node == head.load(std::memory_order_acquire) && !node->next.load(std::memory_order_acquire))
+        throw Errors::EmptyArray();
+    while (Node* next = node->next.load(std::memory_order_acquire)) node = next;
+    return node->data;
+}
+
+template <class T>
+T ConcurrentQueue<T>::Get(int index) const {
+    if (index < 0) throw Errors::IndexOutOfRange();
+    auto guard = EpochDomain::Pin();
+    Node* node = head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire);
+    for (int i = 0; node && i < index; ++i) node = node->next.load(std::memory_order_acquire);
+    if (!node) throw Errors::IndexOutOfRange();
+    return node->data;
+}
+
+template <class T>
+int ConcurrentQueue<T>::GetLength() const {
+    int length = count.load(std::memory_order_relaxed);
+    return length > 0 ? length : 0;
+}
+
+template <class T>
+bool ConcurrentQueue<T>::IsEmpty() const {
+    auto guard = EpochDomain::Pin();
+    return head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr;
+}
+
+template <class T>
+void ConcurrentQueue<T>::Clear() {
+    T item;
+    while (TryDequeue(item)) {}
+}
+
+template <class T>
+void ConcurrentQueue<T>::Map(void (*func)(T&)) const {
+    Node* node = head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire);
+    for (; node; node = node->next.load(std::memory_order_acquire)) func(node->data);
+}
+
+// Отброшенные узлы вырезаются из списка; tail встаёт на последний оставшийся
+template <class T>
+void ConcurrentQueue<T>::Where(bool (*func)(T&)) const {
+    NodeCache::Attach();
+    auto guard = EpochDomain::Pin();
+    Node* kept = head.load(std::memory_order_acquire);
+    Node* node = kept->next.load(std::memory_order_acquire);
+    int removed = 0;
+    while (node) {
+        Node* next = node->next.load(std::memory_order_acquire);
+        if (func(node->data)) {
+            kept->next.store(node, std::memory_order_release);
+            kept = node;
+        } else {
+            EpochDomain::Retire(node, &NodeCache::Put);
+            ++removed;
+        }
+        node = next;
+    }
+    kept->next.store(nullptr, std::memory_order_release);
+    tail.store(kept, std::memory_order_release);
+    count.fetch_sub(removed, std::memory_order_relaxed);
+}
+
+template <class T>
+T ConcurrentQueue<T>::Reduce(T (*func)(const T&, const T&)) const {
+    auto guard = EpochDomain::Pin();
+    Node* node = head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire);
+    if (!node) throw Errors::EmptyArray();
+    T result = node->data;
+    for (node = node->next.load(std::memory_order_acquire); node; node = node->next.load(std::memory_order_acquire))
+        result = func(result, node->data);
+    return result;
+}
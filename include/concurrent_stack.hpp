@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+
+#include "stack.hpp"
+#include "epoch.hpp"
+#include "errors.hpp"
+
+// Lock-free стек Трайбера: односвязный список, вершина меняется одним CAS.
+// Снятые узлы освобождаются через EpochDomain, поэтому чтение next у вершины
+// безопасно, а адрес снятого узла не может вернуться в стек, пока его видит
+// другой поток (ABA невозможна).
+// Push, Pop, Top и TryPop линеаризуемы; GetLength, Get, GetFirst и GetLast при
+// одновременных изменениях дают согласованный с каким-то моментом, но уже
+// возможно устаревший результат.
+template <class T>
+class ConcurrentStack : public Stack<T> {
+protected:
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    std::atomic<Node*> head;
+    std::atomic<int> count;
+
+    // Одна попытка CAS; вызывать под EpochDomain::Guard
+    bool TryPushNode(Node* node);
+    // false — проиграли гонку; true и popped == nullptr — стек пуст
+    bool TryPopNode(Node*& popped);
+    // Значение снятого узла; сам узел уходит на отложенное удаление
+    T Take(Node* popped);
+
+public:
+    ConcurrentStack();
+    ConcurrentStack(T* items, int count);
+    ConcurrentStack(const ConcurrentStack<T>&) = delete;
+    ConcurrentStack<T>& operator=(const ConcurrentStack<T>&) = delete;
+    ~ConcurrentStack() override;
+
+    void Push(const T& item) override;
+    T Pop() override;
+    T Top() const override;
+    // Pop без исключения для пустого стека
+    bool TryPop(T& out);
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+
+    int GetLength() const override;
+    bool IsEmpty() const override;
+
+    void Clear() override;
+};
+
+template <class T>
+ConcurrentStack<T>::ConcurrentStack() : head(nullptr), count(0) {}
+
+template <class T>
+ConcurrentStack<T>::ConcurrentStack(T* items, int count) : ConcurrentStack() {
+    if (count < 0) throw Errors::NegativeCount();
+    for (int i = 0; i < count; ++i) Push(items[i]);
+}
+
+// К моменту разрушения других потоков у стека нет: узлы удаляются сразу
+template <class T>
+ConcurrentStack<T>::~ConcurrentStack() {
+    Node* node = head.load(std::memory_order_relaxed);
+    while (node) {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+template <class T>
+bool ConcurrentStack<T>::TryPushNode(Node* node) {
+    Node* top = head.load(std::memory_order_relaxed);
+    node->next = top;
+    return head.compare_exchange_weak(top, node, std::memory_order_release, std::memory_order_relaxed);
+}
+
+template <class T>
+bool ConcurrentStack<T>::TryPopNode(Node*& popped) {
+    popped = head.load(std::memory_order_acquire);
+    if (!popped) return true;
+    return head.compare_exchange_weak(popped, popped->next, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+template <class T>
+T ConcurrentStack<T>::Take(Node* popped) {
+    // Копия, а не перемещение: Top и Get других потоков могут ещё читать значение
+    T value = popped->value;
+    count.fetch_sub(1, std::memory_order_relaxed);
+    EpochDomain::Retire(popped);
+    return value;
+}
+
+template <class T>
+void ConcurrentStack<T>::Push(const T& item) {
+    Node* node = new Node{item, nullptr};
+    count.fetch_add(1, std::memory_order_relaxed);
+    while (!TryPushNode(node)) {}
+}
+
+template <class T>
+T ConcurrentStack<T>::Pop() {
+    auto guard = EpochDomain::Pin();
+    Node* popped;
+    while (!TryPopNode(popped)) {}
+    if (!popped) throw Errors::EmptyStackError();
+    return Take(popped);
+}
+
+template <class T>
+bool ConcurrentStack<T>::TryPop(T& out) {
+    auto guard = EpochDomain::Pin();
+    Node* popped;
+    while (!TryPopNode(popped)) {}
+    if (!popped) return false;
+    out = Take(popped);
+    return true;
+}
+
+template <class T>
+T ConcurrentStack<T>::Top() const {
+    auto guard = EpochDomain::Pin();
+    Node* top = head.load(std::memory_order_acquire);
+    if (!top) throw Errors::EmptyStackError();
+    return top->value;
+}
+
+template <class T>
+T ConcurrentStack<T>::GetFirst() const {
+    auto guard = EpochDomain::Pin();
+    Node* node = head.load(std::memory_order_acquire);
+    if (!node) throw Errors::EmptyStackError();
+    while (node->next) node = node->next;
+    return node->value;
+}
+
+template <class T>
+T ConcurrentStack<T>::GetLast() const {
+    return Top();
+}
+
+// Индекс считается от дна, как у ArrayStack; проход идёт от вершины
+template <class T>
+T ConcurrentStack<T>::Get(int index) const {
+    auto guard = EpochDomain::Pin();
+    int length = 0;
+    for (Node* node = head.load(std::memory_order_acquire); node; node = node->next) ++length;
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    Node* node = head.load(std::memory_order_acquire);
+    for (int steps = length - 1 - index; node && steps > 0; --steps) node = node->next;
+    if (!node) throw Errors::IndexOutOfRange();
+    return node->value;
+}
+
+template <class T>
+int ConcurrentStack<T>::GetLength() const {
+    int length = count.load(std::memory_order_relaxed);
+    return length > 0 ? length : 0;
+}
+
+template <class T>
+bool ConcurrentStack<T>::IsEmpty() const {
+    return head.load(std::memory_order_acquire) == nullptr;
+}
+
+// Весь список снимается одним обменом и уходит на отложенное удаление
+template <class T>
+void ConcurrentStack<T>::Clear() {
+    auto guard = EpochDomain::Pin();
+    Node* node = head.exchange(nullptr, std::memory_order_acquire);
+    int removed = 0;
+    while (node) {
+        Node* next = node->next;
+        EpochDomain::Retire(node);
+        node = next;
+        ++removed;
+    }
+    count.fetch_sub(removed, std::memory_order_relaxed);
+}
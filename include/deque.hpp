@@ -87,27 +87,27 @@ T ArrayDeque<T>::PopBack() {
 
 template <typename T>
 T ArrayDeque<T>::Front() const {
-    return this->GetFirst();
+    return this->View().GetFirst();
 }
 
 template <typename T>
 T ArrayDeque<T>::Back() const {
-    return this->GetLast();
+    return this->View().GetLast();
 }
 
 template <typename T>
 T ArrayDeque<T>::Get(int index) const {
-    return this->MutableArraySequence<T>::Get(index);
+    return this->View().Get(index);
 }
 
 template <typename T>
 int ArrayDeque<T>::GetLength() const {
-    return this->MutableArraySequence<T>::GetLength();
+    return this->View().GetLength();
 }
 
 template <typename T>
 bool ArrayDeque<T>::IsEmpty() const {
-    return this->GetLength() == 0;
+    return this->View().IsEmpty();
 }
 
 template <typename T>
@@ -180,27 +180,27 @@ T ListDeque<T>::PopBack() {
 
 template <typename T>
 T ListDeque<T>::Front() const {
-    return this->GetFirst();
+    return this->View().GetFirst();
 }
 
 template <typename T>
 T ListDeque<T>::Back() const {
-    return this->GetLast();
+    return this->View().GetLast();
 }
 
 template <typename T>
 T ListDeque<T>::Get(int index) const {
-    return this->MutableListSequence<T>::Get(index);
+    return this->View().Get(index);
 }
 
 template <typename T>
 int ListDeque<T>::GetLength() const {
-    return this->MutableListSequence<T>::GetLength();
+    return this->View().GetLength();
 }
 
 template <typename T>
 bool ListDeque<T>::IsEmpty() const {
-    return this->GetLength() == 0;
+    return this->View().IsEmpty();
 }
 
 template <typename T>
@@ -1,5 +1,8 @@
 #pragma once
+#include <algorithm>
+#include <functional>
 #include <stdexcept>
+#include <type_traits>
 #include "errors.hpp"
 
 template <class T>
@@ -9,11 +12,18 @@ private:
     int size;
     int capacity;
 
+    // Удвоение ёмкости, но не меньше minCapacity
+    void Grow(int minCapacity);
+    // Индекс элемента по адресу item или -1, если item лежит вне массива.
+    // Аргумент может ссылаться на собственный элемент, а Grow освобождает старое хранилище
+    int OwnIndex(const T* item) const;
+
 public:
 //    DynamicArray(); можно сделать, если сделать, чтобы вылетало уведомление о пропущенных полях
     DynamicArray(T* items, int count);
     DynamicArray(int size);
     DynamicArray(const DynamicArray<T>& other);
+    DynamicArray<T>& operator=(const DynamicArray<T>& other);
     ~DynamicArray();
 
     void EnsureCapacity(int newCapacity);
@@ -27,7 +37,18 @@ public:
     void Set(int index, T value);
     void Resize(int newSize);
     DynamicArray<T>* GetSubArray(int startIndex, int endIndex) const;
-
+    void CopyTo(T* out, int start, int count) const;
+    void Insert(int index, const T& value);
+
+    // Операции с концом массива: ёмкость растёт удвоением, поэтому O(1) амортизированно
+    void PushBack(const T& value);
+    void PushBackN(const T* items, int count);
+    T PopBack();
+    // out[0] — бывший последний элемент
+    void PopBackN(T* out, int count);
+    T& Back();
+    // Для тривиально разрушаемых T — O(1), ёмкость сохраняется
+    void Clear();
 
     T& operator[](int index);
     const T& operator[](int index) const;
@@ -36,6 +57,9 @@ public:
         if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
         return data[index];
     }
+
+    T* GetData() { return data; }
+    const T* GetData() const { return data; }
     
 };
 
@@ -66,14 +90,28 @@ DynamicArray<T>::DynamicArray(int size) {
 template <class T>
 DynamicArray<T>::DynamicArray(const DynamicArray<T>& other) {
     size = other.size;
-    capacity = other.capacity;
+    capacity = other.size;
     data = new T[size];
     for (int i = 0; i < size; i++)
         data[i] = other.data[i];
 }
 
+template <class T>
+DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray<T>& other) {
+    if (this == &other) return *this;
+    T* newData = new T[other.size];
+    for (int i = 0; i < other.size; i++)
+        newData[i] = other.data[i];
+    delete[] data;
+    data = newData;
+    size = other.size;
+    capacity = other.size;
+    return *this;
+}
+
 template <class T>
 DynamicArray<T>::~DynamicArray() {
+    delete[] data;
 }
 
 template <class T>
@@ -84,7 +122,7 @@ void DynamicArray<T>::EnsureCapacity(int newCapacity) {
     if (newCapacity > capacity) {
         T* newData = new T[newCapacity];
         for (int i = 0; i < size; i++)
-            newData[i] = data[i];
+            newData[i] = std::move(data[i]);
         delete[] data;
         data = newData;
         capacity = newCapacity;
@@ -158,6 +196,91 @@ DynamicArray<T>* DynamicArray<T>::GetSubArray(int startIndex, int endIndex) cons
     
 }
 
+template <class T>
+void DynamicArray<T>::CopyTo(T* out, int start, int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    if (start < 0 || start + count > size) throw Errors::InvalidIndices();
+    std::copy(data + start, data + start + count, out);
+}
+
+template <class T>
+void DynamicArray<T>::Grow(int minCapacity) {
+    EnsureCapacity(std::max(minCapacity, std::max(4, capacity * 2)));
+}
+
+template <class T>
+int DynamicArray<T>::OwnIndex(const T* item) const {
+    std::less<const T*> before;
+    if (before(item, data) || !before(item, data + size)) return -1;
+    return static_cast<int>(item - data);
+}
+
+// Собственный элемент перечитывается по индексу уже после роста и сдвига
+template <class T>
+void DynamicArray<T>::Insert(int index, const T& value) {
+    if (index < 0 || index > size)
+        throw Errors::IndexOutOfRange();
+    int source = OwnIndex(&value);
+    if (size == capacity) Grow(size + 1);
+    std::move_backward(data + index, data + size, data + size + 1);
+    if (source == -1) data[index] = value;
+    else data[index] = data[source >= index ? source + 1 : source];
+    ++size;
+}
+
+template <class T>
+void DynamicArray<T>::PushBack(const T& value) {
+    int source = size == capacity ? OwnIndex(&value) : -1;
+    if (size == capacity) Grow(size + 1);
+    data[size] = source == -1 ? value : data[source];
+    ++size;
+}
+
+template <class T>
+void DynamicArray<T>::PushBackN(const T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    if (size + count > capacity) {
+        int source = count > 0 ? OwnIndex(items) : -1;
+        Grow(size + count);
+        if (source != -1) items = data + source;
+    }
+    std::copy(items, items + count, data + size);
+    size += count;
+}
+
+template <class T>
+T DynamicArray<T>::PopBack() {
+    if (size == 0) throw Errors::EmptyArray();
+    T value = std::move(data[--size]);
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        data[size] = T();
+    return value;
+}
+
+template <class T>
+void DynamicArray<T>::PopBackN(T* out, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    if (count > size) throw Errors::InvalidIndices();
+    for (int i = 0; i < count; ++i)
+        out[i] = std::move(data[size - 1 - i]);
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        std::fill(data + size - count, data + size, T());
+    size -= count;
+}
+
+template <class T>
+T& DynamicArray<T>::Back() {
+    if (size == 0) throw Errors::EmptyArray();
+    return data[size - 1];
+}
+
+// Освободившиеся элементы сбрасываются, чтобы отдать их ресурсы (строки и т.п.)
+template <class T>
+void DynamicArray<T>::Clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        std::fill(data, data + size, T());
+    size = 0;
+}
 
 template <class T>
 T& DynamicArray<T>::operator[](int index) {
@@ -176,7 +299,5 @@ const T& DynamicArray<T>::operator[](int index) const {
 template<typename T>
 bool operator==(const DynamicArray<T>& lhs, const DynamicArray<T>& rhs) {
     if (lhs.GetSize() != rhs.GetSize()) return false;
-    for (int i = 0; i < lhs.GetSize(); ++i)
-        if (lhs.Get(i) != rhs.Get(i)) return false;
-    return true;
+    return std::equal(lhs.GetData(), lhs.GetData() + lhs.GetSize(), rhs.GetData());
 }
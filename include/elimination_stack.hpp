@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "concurrent_stack.hpp"
+#include "errors.hpp"
+
+// Стек Трайбера с массивом исключения. Если CAS по вершине проигран, Push
+// выкладывает свой узел в случайную ячейку массива и немного ждёт, а Pop
+// забирает выложенный узел оттуда. Встретившиеся Push и Pop взаимно гасятся, не
+// трогая вершину, поэтому при симметричной нагрузке пропускная способность
+// растёт с числом потоков, а не упирается в один указатель.
+// Push закреплён в эпохе, пока его узел лежит в ячейке: иначе Pop мог бы забрать
+// и освободить узел, а другой Push выложить по тому же адресу новый — тогда CAS,
+// отзывающий предложение, сработал бы на чужом узле.
+template <class T>
+class EliminationStack : public ConcurrentStack<T> {
+private:
+    using Node = typename ConcurrentStack<T>::Node;
+
+    static constexpr int Width = 16;
+    static constexpr int SpinLimit = 128;
+
+    // По ячейке на кэш-линию, чтобы соседние обмены не мешали друг другу
+    struct alignas(64) Slot {
+        std::atomic<Node*> offer{nullptr};
+    };
+
+    Slot slots[Width];
+
+    static int RandomSlot();
+    // true — узел забрал Pop; false — никто не пришёл, узел возвращён
+    bool OfferPush(Node* node);
+    // Узел, выложенный каким-нибудь Push, или nullptr
+    Node* TakeOffer();
+    // Общий цикл Pop и TryPop: nullptr для пустого стека
+    Node* PopNode();
+
+public:
+    EliminationStack();
+    EliminationStack(T* items, int count);
+    ~EliminationStack() override = default;
+
+    void Push(const T& item) override;
+    T Pop() override;
+    bool TryPop(T& out);
+};
+
+template <class T>
+EliminationStack<T>::EliminationStack() : ConcurrentStack<T>() {}
+
+template <class T>
+EliminationStack<T>::EliminationStack(T* items, int count) : ConcurrentStack<T>(items, count) {}
+
+template <class T>
+int EliminationStack<T>::RandomSlot() {
+    static thread_local std::uint32_t state = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state)) | 1;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<int>(state % Width);
+}
+
+template <class T>
+bool EliminationStack<T>::OfferPush(Node* node) {
+    std::atomic<Node*>& offer = slots[RandomSlot()].offer;
+    Node* empty = nullptr;
+    if (!offer.compare_exchange_strong(empty, node, std::memory_order_release, std::memory_order_relaxed))
+        return false;
+    for (int spin = 0; spin < SpinLimit; ++spin)
+        if (offer.load(std::memory_order_acquire) != node) return true;
+    // Забираем предложение обратно; неудача значит, что Pop успел его взять
+    Node* expected = node;
+    return !offer.compare_exchange_strong(expected, nullptr, std::memory_order_acquire, std::memory_order_acquire);
+}
+
+template <class T>
+typename EliminationStack<T>::Node* EliminationStack<T>::TakeOffer() {
+    std::atomic<Node*>& offer = slots[RandomSlot()].offer;
+    Node* node = offer.load(std::memory_order_acquire);
+    // Узел разыменовывается только после успешного CAS, когда он уже наш
+    if (node && offer.compare_exchange_strong(node, nullptr, std::memory_order_acquire, std::memory_order_relaxed))
+        return node;
+    return nullptr;
+}
+
+template <class T>
+void EliminationStack<T>::Push(const T& item) {
+    Node* node = new Node{item, nullptr};
+    this->count.fetch_add(1, std::memory_order_relaxed);
+    auto guard = EpochDomain::Pin();
+    while (!this->TryPushNode(node) && !OfferPush(node)) {}
+}
+
+template <class T>
+typename EliminationStack<T>::Node* EliminationStack<T>::PopNode() {
+    Node* popped;
+    while (!this->TryPopNode(popped))
+        if ((popped = TakeOffer())) return popped;
+    return popped ? popped : TakeOffer();
+}
+
+template <class T>
+T EliminationStack<T>::Pop() {
+    auto guard = EpochDomain::Pin();
+    Node* popped = PopNode();
+    if (!popped) throw Errors::EmptyStackError();
+    return this->Take(popped);
+}
+
+template <class T>
+bool EliminationStack<T>::TryPop(T& out) {
+    auto guard = EpochDomain::Pin();
+    Node* popped = PopNode();
+    if (!popped) return false;
+    out = this->Take(popped);
+    return true;
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "dynamic_array.hpp"
+
+// Освобождение памяти по эпохам для lock-free структур.
+// Поток, читающий разделяемые узлы, держит Guard: запись потока помечается
+// активной в текущей глобальной эпохе. Отцепленный узел передаётся в Retire
+// и лежит в корзине своей эпохи; глобальная эпоха растёт, только когда все
+// активные потоки её увидели, поэтому узел из эпохи e освобождается не раньше
+// эпохи e + 2 — ни один поток уже не может держать на него указатель.
+// Это же исключает ABA: адрес узла не переиспользуется, пока он кому-то виден.
+class EpochDomain {
+public:
+    using Deleter = void (*)(void*);
+
+private:
+    struct Record;
+
+public:
+    class Guard {
+    public:
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        ~Guard() { EpochDomain::Unpin(record); }
+
+    private:
+        friend class EpochDomain;
+        Record* record;
+        explicit Guard(Record* record) : record(record) { EpochDomain::Pin(record); }
+    };
+
+    static Guard Pin() { return Guard(Local()); }
+
+    // Узел уже недостижим из структуры; удаляется, когда станет безопасно
+    static void Retire(void* pointer, Deleter deleter);
+
+    template <class T>
+    static void Retire(T* pointer) {
+        Retire(static_cast<void*>(pointer), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    static std::uint64_t CurrentEpoch() { return Instance().epoch.load(); }
+
+private:
+    static constexpr int Bags = 3;
+    static constexpr int ScanPeriod = 64;
+
+    struct Retired {
+        void* pointer = nullptr;
+        Deleter deleter = nullptr;
+    };
+
+    // Запись потока: state = (эпоха << 1) | активен; записи не удаляются до выхода
+    // из программы и переиспользуются новыми потоками вместе с остатком корзин
+    struct Record {
+        std::atomic<std::uint64_t> state{0};
+        std::atomic<bool> inUse{true};
+        Record* next = nullptr;
+        int nesting = 0;
+        int sinceScan = 0;
+        DynamicArray<Retired>* bags[Bags];
+        std::uint64_t bagEpoch[Bags] = {};
+
+        Record() {
+            for (auto& bag : bags) bag = new DynamicArray<Retired>(0);
+        }
+        ~Record() {
+            for (auto* bag : bags) {
+                Free(*bag);
+                delete bag;
+            }
+        }
+    };
+
+    struct LocalHandle {
+        Record* record;
+        LocalHandle() : record(Instance().Acquire()) {}
+        ~LocalHandle() { Instance().Release(record); }
+    };
+
+    std::atomic<std::uint64_t> epoch{1};
+    std::atomic<Record*> records{nullptr};
+
+    EpochDomain() = default;
+    ~EpochDomain();
+
+    static EpochDomain& Instance() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    static Record* Local() {
+        static thread_local LocalHandle handle;
+        return handle.record;
+    }
+
+    static void Pin(Record* record);
+    static void Unpin(Record* record);
+    static void Free(DynamicArray<Retired>& bag);
+
+    Record* Acquire();
+    void Release(Record* record);
+    bool TryAdvance();
+    void Collect(Record* record);
+};
+
+inline EpochDomain::~EpochDomain() {
+    Record* record = records.load();
+    while (record) {
+        Record* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+inline void EpochDomain::Pin(Record* record) {
+    if (record->nesting++ > 0) return;
+    record->state.store((Instance().epoch.load() << 1) | 1);
+    // Пометка активности должна стать видна раньше любых чтений узлов
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void EpochDomain::Unpin(Record* record) {
+    if (--record->nesting > 0) return;
+    record->state.store(0, std::memory_order_release);
+}
+
+inline void EpochDomain::Free(DynamicArray<Retired>& bag) {
+    const Retired* item = bag.GetData();
+    for (int i = 0; i < bag.GetSize(); ++i)
+        item[i].deleter(item[i].pointer);
+    bag.Clear();
+}
+
+inline EpochDomain::Record* EpochDomain::Acquire() {
+    for (Record* record = records.load(); record; record = record->next) {
+        bool expected = false;
+        if (!record->inUse.load() && record->inUse.compare_exchange_strong(expected, true))
+            return record;
+    }
+    Record* record = new Record();
+    Record* head = records.load();
+    do {
+        record->next = head;
+    } while (!records.compare_exchange_weak(head, record));
+    return record;
+}
+
+inline void EpochDomain::Release(Record* record) {
+    record->nesting = 0;
+    record->state.store(0);
+    record->inUse.store(false, std::memory_order_release);
+}
+
+// Эпоха сдвигается, если каждый активный поток уже в ней
+inline bool EpochDomain::TryAdvance() {
+    std::uint64_t current = epoch.load();
+    for (Record* record = records.load(); record; record = record->next) {
+        std::uint64_t state = record->state.load();
+        if ((state & 1) && (state >> 1) != current) return false;
+    }
+    return epoch.compare_exchange_strong(current, current + 1);
+}
+
+inline void EpochDomain::Collect(Record* record) {
+    std::uint64_t current = epoch.load();
+    for (int i = 0; i < Bags; ++i)
+        if (record->bagEpoch[i] + 2 <= current) Free(*record->bags[i]);
+}
+
+inline void EpochDomain::Retire(void* pointer, Deleter deleter) {
+    EpochDomain& domain = Instance();
+    Record* record = Local();
+    std::uint64_t current = domain.epoch.load();
+
+    // Корзина с тем же остатком хранит эпоху current - 3 или старше: её можно освободить
+    int slot = static_cast<int>(current % Bags);
+    if (record->bagEpoch[slot] != current) {
+        Free(*record->bags[slot]);
+        record->bagEpoch[slot] = current;
+    }
+    record->bags[slot]->PushBack(Retired{pointer, deleter});
+
+    if (++record->sinceScan >= ScanPeriod) {
+        record->sinceScan = 0;
+        domain.TryAdvance();
+        domain.Collect(record);
+    }
+}
@@ -24,7 +24,10 @@ enum class ErrorCode {
     NEGATIVE_COUNT,
     NULL_LIST,
     CONCAT_TYPE_MISMATCH,
-    EMPTY_STACK
+    EMPTY_STACK,
+    KEY_NOT_FOUND,
+    STALE_HANDLE,
+    FULL
 };
 
 inline std::vector<Error> ErrorsList = {
@@ -41,7 +44,10 @@ inline std::vector<Error> ErrorsList = {
     {10, "Negative count"},
     {11, "Null list"},
     {12, "Cannot concat sequences of different types"},
-    {13, "Empty stack"}
+    {13, "Empty stack"},
+    {14, "Key not found"},
+    {15, "Stale handle"},
+    {16, "Container is full"}
 };
 
 namespace Errors {
@@ -123,4 +129,16 @@ namespace Errors {
     inline std::runtime_error EmptyStackError() {
         return std::runtime_error(ErrorsList[static_cast<int>(ErrorCode::EMPTY_STACK)].message);
     }
+
+    inline std::out_of_range KeyNotFound() {
+        return std::out_of_range(ErrorsList[static_cast<int>(ErrorCode::KEY_NOT_FOUND)].message);
+    }
+
+    inline std::invalid_argument StaleHandle() {
+        return std::invalid_argument(ErrorsList[static_cast<int>(ErrorCode::STALE_HANDLE)].message);
+    }
+
+    inline std::overflow_error Full() {
+        return std::overflow_error(ErrorsList[static_cast<int>(ErrorCode::FULL)].message);
+    }
 }
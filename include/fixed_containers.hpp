@@ -0,0 +1,255 @@
+#pragma once
+
+#include "stack.hpp"
+#include "queue.hpp"
+#include "deque.hpp"
+#include "errors.hpp"
+
+// Кольцевой буфер на N элементов со встроенным хранилищем, без обращений к куче.
+// Все операции constexpr: FixedRing можно заполнять и читать при компиляции,
+// а переполнение или чтение из пустого кольца в константном выражении
+// становится ошибкой компиляции. Требует T с конструктором по умолчанию.
+template <class T, int N>
+class FixedRing {
+    static_assert(N > 0, "FixedRing capacity must be positive");
+
+private:
+    T items[N]{};
+    int head = 0;
+    int count = 0;
+
+    static constexpr int Wrap(int index) { return index >= N ? index - N : index; }
+
+public:
+    static constexpr int Capacity = N;
+
+    FixedRing() = default;
+
+    // Число значений проверяется при компиляции
+    template <class... U>
+    static constexpr FixedRing Of(const U&... values) {
+        static_assert(sizeof...(U) <= N, "Too many values for FixedRing capacity");
+        FixedRing ring;
+        (ring.PushBack(values), ...);
+        return ring;
+    }
+
+    constexpr int GetLength() const { return count; }
+    constexpr bool IsEmpty() const { return count == 0; }
+    constexpr bool IsFull() const { return count == N; }
+
+    constexpr void PushBack(const T& item) {
+        if (count == N) throw Errors::Full();
+        items[Wrap(head + count)] = item;
+        ++count;
+    }
+
+    constexpr void PushFront(const T& item) {
+        if (count == N) throw Errors::Full();
+        head = head == 0 ? N - 1 : head - 1;
+        items[head] = item;
+        ++count;
+    }
+
+    constexpr T PopFront() {
+        if (count == 0) throw Errors::EmptyArray();
+        T item = items[head];
+        items[head] = T();
+        head = Wrap(head + 1);
+        --count;
+        return item;
+    }
+
+    constexpr T PopBack() {
+        if (count == 0) throw Errors::EmptyArray();
+        int last = Wrap(head + count - 1);
+        T item = items[last];
+        items[last] = T();
+        --count;
+        return item;
+    }
+
+    constexpr const T& Front() const {
+        if (count == 0) throw Errors::EmptyArray();
+        return items[head];
+    }
+
+    constexpr const T& Back() const {
+        if (count == 0) throw Errors::EmptyArray();
+        return items[Wrap(head + count - 1)];
+    }
+
+    constexpr const T& At(int index) const {
+        if (index < 0 || index >= count) throw Errors::IndexOutOfRange();
+        return items[Wrap(head + index)];
+    }
+
+    constexpr T& At(int index) {
+        if (index < 0 || index >= count) throw Errors::IndexOutOfRange();
+        return items[Wrap(head + index)];
+    }
+
+    constexpr void Clear() {
+        while (count > 0) PopBack();
+        head = 0;
+    }
+
+    // Оставляет элементы, для которых keep(item) истинно, сохраняя порядок
+    template <class F>
+    constexpr void Filter(F&& keep) {
+        int kept = 0;
+        for (int i = 0; i < count; ++i) {
+            T& item = items[Wrap(head + i)];
+            if (keep(item)) items[Wrap(head + kept++)] = item;
+        }
+        for (int i = kept; i < count; ++i) items[Wrap(head + i)] = T();
+        count = kept;
+    }
+};
+
+// Стек на встроенном массиве: вершина — конец кольца, которое здесь не заворачивается
+template <class T, int N>
+class FixedStack : public Stack<T> {
+private:
+    FixedRing<T, N> ring;
+
+public:
+    static constexpr int Capacity = N;
+
+    FixedStack() = default;
+    FixedStack(T* items, int count);
+    explicit FixedStack(const FixedRing<T, N>& ring) : ring(ring) {}
+
+    void Push(const T& item) override { ring.PushBack(item); }
+    T Pop() override;
+    T Top() const override;
+
+    T GetFirst() const override;
+    T GetLast() const override { return Top(); }
+    T Get(int index) const override { return ring.At(index); }
+
+    int GetLength() const override { return ring.GetLength(); }
+    bool IsEmpty() const override { return ring.IsEmpty(); }
+    bool IsFull() const { return ring.IsFull(); }
+
+    void Clear() override { ring.Clear(); }
+};
+
+template <class T, int N>
+FixedStack<T, N>::FixedStack(T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    if (count > N) throw Errors::Full();
+    for (int i = 0; i < count; ++i) ring.PushBack(items[i]);
+}
+
+template <class T, int N>
+T FixedStack<T, N>::Pop() {
+    if (ring.IsEmpty()) throw Errors::EmptyStackError();
+    return ring.PopBack();
+}
+
+template <class T, int N>
+T FixedStack<T, N>::Top() const {
+    if (ring.IsEmpty()) throw Errors::EmptyStackError();
+    return ring.Back();
+}
+
+template <class T, int N>
+T FixedStack<T, N>::GetFirst() const {
+    if (ring.IsEmpty()) throw Errors::EmptyStackError();
+    return ring.Front();
+}
+
+// Очередь-кольцо: Enqueue в конец, Dequeue из начала, без сдвигов
+template <class T, int N>
+class FixedQueue : public Queue<T> {
+private:
+    // Map и Where интерфейса Queue меняют элементы из const-методов
+    mutable FixedRing<T, N> ring;
+
+public:
+    static constexpr int Capacity = N;
+
+    FixedQueue() = default;
+    FixedQueue(T* items, int count);
+    explicit FixedQueue(const FixedRing<T, N>& ring) : ring(ring) {}
+
+    void Enqueue(const T& item) override { ring.PushBack(item); }
+    T Dequeue() override { return ring.PopFront(); }
+    T Peek() const override { return ring.Front(); }
+
+    T GetFirst() const override { return ring.Front(); }
+    T GetLast() const override { return ring.Back(); }
+    T Get(int index) const override { return ring.At(index); }
+
+    int GetLength() const override { return ring.GetLength(); }
+    bool IsEmpty() const override { return ring.IsEmpty(); }
+    bool IsFull() const { return ring.IsFull(); }
+
+    void Clear() override { ring.Clear(); }
+
+    void Map(void (*func)(T&)) const override;
+    void Where(bool (*func)(T&)) const override;
+    T Reduce(T (*func)(const T&, const T&)) const override;
+};
+
+template <class T, int N>
+FixedQueue<T, N>::FixedQueue(T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    if (count > N) throw Errors::Full();
+    for (int i = 0; i < count; ++i) ring.PushBack(items[i]);
+}
+
+template <class T, int N>
+void FixedQueue<T, N>::Map(void (*func)(T&)) const {
+    for (int i = 0; i < ring.GetLength(); ++i)
+        func(ring.At(i));
+}
+
+template <class T, int N>
+void FixedQueue<T, N>::Where(bool (*func)(T&)) const {
+    ring.Filter(func);
+}
+
+template <class T, int N>
+T FixedQueue<T, N>::Reduce(T (*func)(const T&, const T&)) const {
+    T result = ring.Front();
+    for (int i = 1; i < ring.GetLength(); ++i)
+        result = func(result, ring.At(i));
+    return result;
+}
+
+// Дек на том же кольце: вставка и удаление с обоих концов за O(1)
+template <class T, int N>
+class FixedDeque : public Deque<T> {
+private:
+    FixedRing<T, N> ring;
+
+public:
+    static constexpr int Capacity = N;
+
+    FixedDeque() = default;
+    FixedDeque(T* items, int count);
+    explicit FixedDeque(const FixedRing<T, N>& ring) : ring(ring) {}
+
+    void PushFront(const T& item) override { ring.PushFront(item); }
+    void PushBack(const T& item) override { ring.PushBack(item); }
+    T PopFront() override { return ring.PopFront(); }
+    T PopBack() override { return ring.PopBack(); }
+    T Front() const override { return ring.Front(); }
+    T Back() const override { return ring.Back(); }
+
+    T Get(int index) const override { return ring.At(index); }
+    int GetLength() const override { return ring.GetLength(); }
+    bool IsEmpty() const override { return ring.IsEmpty(); }
+    bool IsFull() const { return ring.IsFull(); }
+
+    void Clear() override { ring.Clear(); }
+};
+
+template <class T, int N>
+FixedDeque<T, N>::FixedDeque(T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    if (count > N) throw Errors::Full();
+    for (int i = 0; i < count; ++i) ring.PushBack(items[i]);
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "dynamic_array.hpp"
+#include "errors.hpp"
+
+// Хэш-функция по умолчанию; для своих типов специализируется как std::hash
+template <class K>
+struct Hasher {
+    std::size_t operator()(const K& key) const { return std::hash<K>()(key); }
+};
+
+// Хэш-таблица с открытой адресацией по схеме Robin Hood.
+// Записи лежат подряд в одном DynamicArray, рядом — массив байтов метаданных
+// с расстоянием от «домашней» ячейки (0 — ячейка пуста). При вставке запись
+// с меньшим расстоянием уступает место, поэтому цепочки короткие, а поиск
+// останавливается, как только расстояние в ячейке меньше текущего.
+// Удаление — обратным сдвигом, без надгробий. Память выделяется только при росте.
+template <class K, class V, class Hash = Hasher<K>>
+class HashTable {
+private:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    static constexpr int MinCapacity = 8;
+    static constexpr int MaxDistance = 255;
+
+    DynamicArray<Entry>* entries;
+    DynamicArray<unsigned char>* distances;
+    int count;
+    int shift; // 64 - log2(ёмкости): старшие биты перемешанного хэша дают номер ячейки
+    Hash hasher;
+
+    int Capacity() const { return entries->GetSize(); }
+    int Home(const K& key) const;
+    int FindIndex(const K& key) const;
+    void InsertNew(Entry entry);
+    void Rehash(int newCapacity);
+    void Allocate(int capacity);
+
+public:
+    HashTable();
+    explicit HashTable(int expectedCount);
+    HashTable(const HashTable<K, V, Hash>& other);
+    HashTable(HashTable<K, V, Hash>&& other) noexcept;
+    HashTable<K, V, Hash>& operator=(HashTable<K, V, Hash> other);
+    ~HashTable();
+
+    // Вставка или замена значения
+    void Set(const K& key, const V& value);
+    V Get(const K& key) const;
+    V* Find(const K& key);
+    const V* Find(const K& key) const;
+    bool Contains(const K& key) const;
+    bool Remove(const K& key);
+
+    int GetCount() const;
+    int GetCapacity() const;
+    bool IsEmpty() const;
+    void Reserve(int expectedCount);
+    void Clear();
+
+    // func(key, value) для каждой записи в порядке ячеек
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+template <class K, class V, class Hash>
+void HashTable<K, V, Hash>::Allocate(int capacity) {
+    entries = new DynamicArray<Entry>(capacity);
+    distances = new DynamicArray<unsigned char>(capacity);
+    std::fill(distances->GetData(), distances->GetData() + capacity, 0);
+    shift = 64;
+    for (int c = capacity; c > 1; c >>= 1) --shift;
+}
+
+template <class K, class V, class Hash>
+HashTable<K, V, Hash>::HashTable() : count(0) {
+    Allocate(MinCapacity);
+}
+
+template <class K, class V, class Hash>
+HashTable<K, V, Hash>::HashTable(int expectedCount) : count(0) {
+    if (expectedCount < 0) throw Errors::NegativeSize();
+    Allocate(MinCapacity);
+    Reserve(expectedCount);
+}
+
+template <class K, class V, class Hash>
+HashTable<K, V, Hash>::HashTable(const HashTable<K, V, Hash>& other)
+    : entries(new DynamicArray<Entry>(*other.entries)),
+      distances(new DynamicArray<unsigned char>(*other.distances)),
+      count(other.count), shift(other.shift), hasher(other.hasher) {}
+
+template <class K, class V, class Hash>
+HashTable<K, V, Hash>::HashTable(HashTable<K, V, Hash>&& other) noexcept
+    : entries(other.entries), distances(other.distances),
+      count(other.count), shift(other.shift), hasher(std::move(other.hasher)) {
+    other.entries = nullptr;
+    other.distances = nullptr;
+    other.count = 0;
+}
+
+template <class K, class V, class Hash>
+HashTable<K, V, Hash>& HashTable<K, V, Hash>::operator=(HashTable<K, V, Hash> other) {
+    std::swap(entries, other.entries);
+    std::swap(distances, other.distances);
+    std::swap(count, other.count);
+    std::swap(shift, other.shift);
+    std::swap(hasher, other.hasher);
+    return *this;
+}
+
+template <class K, class V, class Hash>
+HashTable<K, V, Hash>::~HashTable() {
+    delete entries;
+    delete distances;
+}
+
+// Фибоначчиево перемешивание: даже тождественный std::hash<int> распределяется равномерно
+template <class K, class V, class Hash>
+int HashTable<K, V, Hash>::Home(const K& key) const {
+    std::uint64_t mixed = static_cast<std::uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<int>(mixed >> shift);
+}
+
+template <class K, class V, class Hash>
+int HashTable<K, V, Hash>::FindIndex(const K& key) const {
+    const Entry* slots = entries->GetData();
+    const unsigned char* dist = distances->GetData();
+    int mask = Capacity() - 1;
+    int index = Home(key);
+    for (int distance = 1; dist[index] >= distance; ++distance) {
+        if (dist[index] == distance && slots[index].key == key) return index;
+        index = (index + 1) & mask;
+    }
+    return -1;
+}
+
+// Ключа в таблице заведомо нет
+template <class K, class V, class Hash>
+void HashTable<K, V, Hash>::InsertNew(Entry entry) {
+    while (true) {
+        Entry* slots = entries->GetData();
+        unsigned char* dist = distances->GetData();
+        int mask = Capacity() - 1;
+        int index = Home(entry.key);
+        int distance = 1;
+        while (distance < MaxDistance) {
+            if (dist[index] == 0) {
+                slots[index] = std::move(entry);
+                dist[index] = static_cast<unsigned char>(distance);
+                return;
+            }
+            if (dist[index] < distance) {
+                std::swap(slots[index], entry);
+                int displaced = dist[index];
+                dist[index] = static_cast<unsigned char>(distance);
+                distance = displaced;
+            }
+            index = (index + 1) & mask;
+            ++distance;
+        }
+        // Слишком длинная цепочка: расширяемся и продолжаем с вытесненной записью
+        Rehash(Capacity() * 2);
+    }
+}
+
+template <class K, class V, class Hash>
+void HashTable<K, V, Hash>::Rehash(int newCapacity) {
+    DynamicArray<Entry>* oldEntries = entries;
+    DynamicArray<unsigned char>* oldDistances = distances;
+    Allocate(newCapacity);
+
+    Entry* slots = oldEntries->GetData();
+    const unsigned char* dist = oldDistances->GetData();
+    for (int i = 0; i < oldEntries->GetSize(); ++i)
+        if (dist[i] != 0) InsertNew(std::move(slots[i]));
+
+    delete oldEntries;
+    delete oldDistances;
+}
+
+template <class K, class V, class Hash>
+void HashTable<K, V, Hash>::Set(const K& key, const V& value) {
+    int index = FindIndex(key);
+    if (index != -1) {
+        entries->GetData()[index].value = value;
+        return;
+    }
+    Reserve(count + 1);
+    InsertNew(Entry{key, value});
+    ++count;
+}
+
+template <class K, class V, class Hash>
+V HashTable<K, V, Hash>::Get(const K& key) const {
+    const V* value = Find(key);
+    if (!value) throw Errors::KeyNotFound();
+    return *value;
+}
+
+template <class K, class V, class Hash>
+V* HashTable<K, V, Hash>::Find(const K& key) {
+    int index = FindIndex(key);
+    return index == -1 ? nullptr : &entries->GetData()[index].value;
+}
+
+template <class K, class V, class Hash>
+const V* HashTable<K, V, Hash>::Find(const K& key) const {
+    int index = FindIndex(key);
+    return index == -1 ? nullptr : &entries->GetData()[index].value;
+}
+
+template <class K, class V, class Hash>
+bool HashTable<K, V, Hash>::Contains(const K& key) const {
+    return FindIndex(key) != -1;
+}
+
+// Обратный сдвиг: следующие записи цепочки подтягиваются на одну ячейку ближе к дому
+template <class K, class V, class Hash>
+bool HashTable<K, V, Hash>::Remove(const K& key) {
+    int index = FindIndex(key);
+    if (index == -1) return false;
+
+    Entry* slots = entries->GetData();
+    unsigned char* dist = distances->GetData();
+    int mask = Capacity() - 1;
+    int next = (index + 1) & mask;
+    while (dist[next] > 1) {
+        slots[index] = std::move(slots[next]);
+        dist[index] = static_cast<unsigned char>(dist[next] - 1);
+        index = next;
+        next = (next + 1) & mask;
+    }
+    slots[index] = Entry();
+    dist[index] = 0;
+    --count;
+    return true;
+}
+
+template <class K, class V, class Hash>
+int HashTable<K, V, Hash>::GetCount() const {
+    return count;
+}
+
+template <class K, class V, class Hash>
+int HashTable<K, V, Hash>::GetCapacity() const {
+    return Capacity();
+}
+
+template <class K, class V, class Hash>
+bool HashTable<K, V, Hash>::IsEmpty() const {
+    return count == 0;
+}
+
+// Коэффициент заполнения не превышает 7/8
+template <class K, class V, class Hash>
+void HashTable<K, V, Hash>::Reserve(int expectedCount) {
+    int capacity = Capacity();
+    while (static_cast<long long>(expectedCount) * 8 > static_cast<long long>(capacity) * 7)
+        capacity *= 2;
+    if (capacity != Capacity()) Rehash(capacity);
+}
+
+template <class K, class V, class Hash>
+void HashTable<K, V, Hash>::Clear() {
+    delete entries;
+    delete distances;
+    Allocate(MinCapacity);
+    count = 0;
+}
+
+template <class K, class V, class Hash>
+template <class F>
+void HashTable<K, V, Hash>::ForEach(F&& func) const {
+    const Entry* slots = entries->GetData();
+    const unsigned char* dist = distances->GetData();
+    for (int i = 0; i < Capacity(); ++i)
+        if (dist[i] != 0) func(slots[i].key, slots[i].value);
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "lazy_stream.hpp"
+#include "errors.hpp"
+
+// Персистентный дек реального времени (Okasaki, "Real-Time Deques").
+// Обе половины — ленивые потоки со своими расписаниями; когда одна половина
+// становится больше другой в Balance + 1 раз, запускается инкрементальная
+// перестройка (RotateDrop/RotateRev), которая продвигается на O(1) шагов
+// за каждую операцию. Все операции стоят O(1) в худшем случае.
+template <class T>
+class ImmutableDeque {
+private:
+    static constexpr int Balance = 3;
+
+    int frontLength;
+    LazyStream<T> front;
+    LazyStream<T> frontSchedule;
+    int rearLength;
+    LazyStream<T> rear;
+    LazyStream<T> rearSchedule;
+
+    ImmutableDeque(int frontLength, LazyStream<T> front, LazyStream<T> frontSchedule,
+                   int rearLength, LazyStream<T> rear, LazyStream<T> rearSchedule);
+
+    static LazyStream<T> Exec1(const LazyStream<T>& schedule);
+    static LazyStream<T> Exec2(const LazyStream<T>& schedule);
+
+    static LazyStream<T> RotateRev(const LazyStream<T>& front, const LazyStream<T>& rear, const LazyStream<T>& acc);
+    static LazyStream<T> RotateDrop(const LazyStream<T>& front, int count, const LazyStream<T>& rear);
+
+    static ImmutableDeque<T> Check(int frontLength, const LazyStream<T>& front, const LazyStream<T>& frontSchedule,
+                                   int rearLength, const LazyStream<T>& rear, const LazyStream<T>& rearSchedule);
+
+public:
+    ImmutableDeque();
+
+    ImmutableDeque<T> PushFront(const T& item) const;
+    ImmutableDeque<T> PushBack(const T& item) const;
+    ImmutableDeque<T> PopFront() const;
+    ImmutableDeque<T> PopBack() const;
+    T Front() const;
+    T Back() const;
+
+    int GetLength() const;
+    bool IsEmpty() const;
+
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+template <class T>
+ImmutableDeque<T>::ImmutableDeque() : frontLength(0), rearLength(0) {}
+
+template <class T>
+ImmutableDeque<T>::ImmutableDeque(int frontLength, LazyStream<T> front, LazyStream<T> frontSchedule,
+                                  int rearLength, LazyStream<T> rear, LazyStream<T> rearSchedule)
+    : frontLength(frontLength), front(std::move(front)), frontSchedule(std::move(frontSchedule)),
+      rearLength(rearLength), rear(std::move(rear)), rearSchedule(std::move(rearSchedule)) {}
+
+template <class T>
+LazyStream<T> ImmutableDeque<T>::Exec1(const LazyStream<T>& schedule) {
+    return schedule.IsEmpty() ? schedule : schedule.Tail();
+}
+
+template <class T>
+LazyStream<T> ImmutableDeque<T>::Exec2(const LazyStream<T>& schedule) {
+    return Exec1(Exec1(schedule));
+}
+
+// RotateRev(f, r, a) = f ++ reverse(r) ++ a, за шаг переворачивается Balance элементов r
+template <class T>
+LazyStream<T> ImmutableDeque<T>::RotateRev(const LazyStream<T>& front, const LazyStream<T>& rear, const LazyStream<T>& acc) {
+    return LazyStream<T>::Lazy([front, rear, acc]() {
+        if (front.IsEmpty()) return rear.Reverse().Append(acc);
+        LazyStream<T> nextAcc = rear.Take(Balance).Reverse().Append(acc);
+        return LazyStream<T>::Cons(front.GetFirst(), RotateRev(front.Tail(), rear.Drop(Balance), nextAcc));
+    });
+}
+
+// RotateDrop(f, i, r) = f ++ reverse(drop(i, r))
+template <class T>
+LazyStream<T> ImmutableDeque<T>::RotateDrop(const LazyStream<T>& front, int count, const LazyStream<T>& rear) {
+    return LazyStream<T>::Lazy([front, count, rear]() {
+        if (count < Balance) return RotateRev(front, rear.Drop(count), LazyStream<T>());
+        return LazyStream<T>::Cons(front.GetFirst(), RotateDrop(front.Tail(), count - Balance, rear.Drop(Balance)));
+    });
+}
+
+template <class T>
+ImmutableDeque<T> ImmutableDeque<T>::Check(int frontLength, const LazyStream<T>& front, const LazyStream<T>& frontSchedule,
+                                           int rearLength, const LazyStream<T>& rear, const LazyStream<T>& rearSchedule) {
+    if (frontLength > Balance * rearLength + 1) {
+        int newFront = (frontLength + rearLength) / 2;
+        int newRear = frontLength + rearLength - newFront;
+        LazyStream<T> f = front.Take(newFront);
+        LazyStream<T> r = RotateDrop(rear, newFront, front);
+        return ImmutableDeque<T>(newFront, f, f, newRear, r, r);
+    }
+    if (rearLength > Balance * frontLength + 1) {
+        int newRear = (frontLength + rearLength) / 2;
+        int newFront = frontLength + rearLength - newRear;
+        LazyStream<T> r = rear.Take(newRear);
+        LazyStream<T> f = RotateDrop(front, newRear, rear);
+        return ImmutableDeque<T>(newFront, f, f, newRear, r, r);
+    }
+    return ImmutableDeque<T>(frontLength, front, frontSchedule, rearLength, rear, rearSchedule);
+}
+
+template <class T>
+ImmutableDeque<T> ImmutableDeque<T>::PushFront(const T& item) const {
+    return Check(frontLength + 1, LazyStream<T>::Cons(item, front), Exec1(frontSchedule),
+                 rearLength, rear, Exec1(rearSchedule));
+}
+
+template <class T>
+ImmutableDeque<T> ImmutableDeque<T>::PushBack(const T& item) const {
+    return Check(frontLength, front, Exec1(frontSchedule),
+                 rearLength + 1, LazyStream<T>::Cons(item, rear), Exec1(rearSchedule));
+}
+
+// При пустом front в rear не больше одного элемента (и наоборот)
+template <class T>
+ImmutableDeque<T> ImmutableDeque<T>::PopFront() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    if (frontLength == 0) return ImmutableDeque<T>();
+    return Check(frontLength - 1, front.Tail(), Exec2(frontSchedule),
+                 rearLength, rear, Exec2(rearSchedule));
+}
+
+template <class T>
+ImmutableDeque<T> ImmutableDeque<T>::PopBack() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    if (rearLength == 0) return ImmutableDeque<T>();
+    return Check(frontLength, front, Exec2(frontSchedule),
+                 rearLength - 1, rear.Tail(), Exec2(rearSchedule));
+}
+
+template <class T>
+T ImmutableDeque<T>::Front() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    return frontLength > 0 ? front.GetFirst() : rear.GetFirst();
+}
+
+template <class T>
+T ImmutableDeque<T>::Back() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    return rearLength > 0 ? rear.GetFirst() : front.GetFirst();
+}
+
+template <class T>
+int ImmutableDeque<T>::GetLength() const {
+    return frontLength + rearLength;
+}
+
+template <class T>
+bool ImmutableDeque<T>::IsEmpty() const {
+    return GetLength() == 0;
+}
+
+template <class T>
+template <class F>
+void ImmutableDeque<T>::ForEach(F&& func) const {
+    front.ForEach(func);
+    rear.Reverse().ForEach(func);
+}
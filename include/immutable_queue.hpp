@@ -0,0 +1,99 @@
+#pragma once
+
+#include "lazy_stream.hpp"
+#include "persistent_list.hpp"
+#include "errors.hpp"
+
+// Персистентная очередь реального времени (Okasaki, "Real-Time Queues").
+// front — ленивый поток, rear — обычный список в обратном порядке,
+// schedule — ещё не вычисленный суффикс front. Каждая операция вычисляет
+// ровно одну ячейку расписания, поэтому Enqueue/Dequeue стоят O(1) в худшем случае.
+// Объект неизменяем: старые версии можно читать из других потоков без блокировок.
+template <class T>
+class ImmutableQueue {
+private:
+    LazyStream<T> front;
+    PersistentList<T> rear;
+    LazyStream<T> schedule;
+    int size;
+
+    ImmutableQueue(LazyStream<T> front, PersistentList<T> rear, LazyStream<T> schedule, int size);
+
+    static LazyStream<T> Rotate(const LazyStream<T>& front, const PersistentList<T>& rear, const LazyStream<T>& acc);
+    static ImmutableQueue<T> Exec(const LazyStream<T>& front, const PersistentList<T>& rear,
+                                  const LazyStream<T>& schedule, int size);
+
+public:
+    ImmutableQueue();
+
+    ImmutableQueue<T> Enqueue(const T& item) const;
+    ImmutableQueue<T> Dequeue() const;
+    T Peek() const;
+
+    int GetLength() const;
+    bool IsEmpty() const;
+
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+template <class T>
+ImmutableQueue<T>::ImmutableQueue() : size(0) {}
+
+template <class T>
+ImmutableQueue<T>::ImmutableQueue(LazyStream<T> front, PersistentList<T> rear, LazyStream<T> schedule, int size)
+    : front(std::move(front)), rear(std::move(rear)), schedule(std::move(schedule)), size(size) {}
+
+// rotate(f, r, a) = f ++ reverse(r) ++ a, при |r| = |f| + 1; каждый шаг — одна ячейка
+template <class T>
+LazyStream<T> ImmutableQueue<T>::Rotate(const LazyStream<T>& front, const PersistentList<T>& rear, const LazyStream<T>& acc) {
+    return LazyStream<T>::Lazy([front, rear, acc]() {
+        LazyStream<T> nextAcc = LazyStream<T>::Cons(rear.GetFirst(), acc);
+        if (front.IsEmpty()) return nextAcc;
+        return LazyStream<T>::Cons(front.GetFirst(), Rotate(front.Tail(), rear.Tail(), nextAcc));
+    });
+}
+
+template <class T>
+ImmutableQueue<T> ImmutableQueue<T>::Exec(const LazyStream<T>& front, const PersistentList<T>& rear,
+                                          const LazyStream<T>& schedule, int size) {
+    if (!schedule.IsEmpty())
+        return ImmutableQueue<T>(front, rear, schedule.Tail(), size);
+
+    LazyStream<T> rotated = Rotate(front, rear, LazyStream<T>());
+    return ImmutableQueue<T>(rotated, PersistentList<T>(), rotated, size);
+}
+
+template <class T>
+ImmutableQueue<T> ImmutableQueue<T>::Enqueue(const T& item) const {
+    return Exec(front, rear.Prepend(item), schedule, size + 1);
+}
+
+template <class T>
+ImmutableQueue<T> ImmutableQueue<T>::Dequeue() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    return Exec(front.Tail(), rear, schedule, size - 1);
+}
+
+template <class T>
+T ImmutableQueue<T>::Peek() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    return front.GetFirst();
+}
+
+template <class T>
+int ImmutableQueue<T>::GetLength() const {
+    return size;
+}
+
+template <class T>
+bool ImmutableQueue<T>::IsEmpty() const {
+    return size == 0;
+}
+
+template <class T>
+template <class F>
+void ImmutableQueue<T>::ForEach(F&& func) const {
+    front.ForEach(func);
+    rear.Reverse().ForEach(func);
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "errors.hpp"
+
+// Ленивый поток (список с отложенными хвостами) с мемоизацией.
+// Каждая ячейка вычисляется не более одного раза; вычисление защищено
+// std::call_once, поэтому один и тот же поток можно читать из нескольких
+// потоков без внешней блокировки.
+template <class T>
+class LazyStream {
+private:
+    struct Cell {
+        bool lazy;
+        std::once_flag once;
+        std::function<LazyStream<T>()> thunk;
+
+        bool empty = true;
+        T head{};
+        std::shared_ptr<Cell> tail;
+
+        Cell() : lazy(false) {}
+        explicit Cell(std::function<LazyStream<T>()> thunk) : lazy(true), thunk(std::move(thunk)) {}
+        ~Cell();
+    };
+
+    std::shared_ptr<Cell> cell; // nullptr — пустой поток
+
+    explicit LazyStream(std::shared_ptr<Cell> cell);
+
+    const Cell* Force() const;
+
+public:
+    LazyStream();
+
+    static LazyStream<T> Cons(const T& head, const LazyStream<T>& tail);
+    static LazyStream<T> Lazy(std::function<LazyStream<T>()> thunk);
+
+    bool IsEmpty() const;
+    T GetFirst() const;
+    LazyStream<T> Tail() const;
+
+    LazyStream<T> Take(int count) const;       // лениво
+    LazyStream<T> Drop(int count) const;       // вычисляет count ячеек
+    LazyStream<T> Reverse() const;             // вычисляет весь поток
+    LazyStream<T> Append(const LazyStream<T>& other) const; // лениво
+
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+// Хвосты освобождаем в цикле, чтобы не уйти в глубокую рекурсию деструкторов
+template <class T>
+LazyStream<T>::Cell::~Cell() {
+    std::shared_ptr<Cell> cur = std::move(tail);
+    while (cur && cur.use_count() == 1) {
+        std::shared_ptr<Cell> next = std::move(cur->tail);
+        cur = std::move(next);
+    }
+}
+
+template <class T>
+LazyStream<T>::LazyStream() : cell(nullptr) {}
+
+template <class T>
+LazyStream<T>::LazyStream(std::shared_ptr<Cell> cell) : cell(std::move(cell)) {}
+
+template <class T>
+const typename LazyStream<T>::Cell* LazyStream<T>::Force() const {
+    if (!cell) return nullptr;
+    if (cell->lazy) {
+        Cell* c = cell.get();
+        std::call_once(c->once, [c]() {
+            LazyStream<T> result = c->thunk();
+            c->thunk = nullptr;
+            const Cell* forced = result.Force();
+            if (forced && !forced->empty) {
+                c->head = forced->head;
+                c->tail = forced->tail;
+                c->empty = false;
+            }
+        });
+    }
+    return cell.get();
+}
+
+template <class T>
+LazyStream<T> LazyStream<T>::Cons(const T& head, const LazyStream<T>& tail) {
+    auto c = std::make_shared<Cell>();
+    c->empty = false;
+    c->head = head;
+    c->tail = tail.cell;
+    return LazyStream<T>(std::move(c));
+}
+
+template <class T>
+LazyStream<T> LazyStream<T>::Lazy(std::function<LazyStream<T>()> thunk) {
+    return LazyStream<T>(std::make_shared<Cell>(std::move(thunk)));
+}
+
+template <class T>
+bool LazyStream<T>::IsEmpty() const {
+    const Cell* c = Force();
+    return c == nullptr || c->empty;
+}
+
+template <class T>
+T LazyStream<T>::GetFirst() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    return cell->head;
+}
+
+template <class T>
+LazyStream<T> LazyStream<T>::Tail() const {
+    if (IsEmpty()) throw Errors::EmptyList();
+    return LazyStream<T>(cell->tail);
+}
+
+template <class T>
+LazyStream<T> LazyStream<T>::Take(int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    LazyStream<T> self = *this;
+    return Lazy([self, count]() {
+        if (count == 0 || self.IsEmpty()) return LazyStream<T>();
+        return Cons(self.GetFirst(), self.Tail().Take(count - 1));
+    });
+}
+
+template <class T>
+LazyStream<T> LazyStream<T>::Drop(int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    LazyStream<T> result = *this;
+    for (int i = 0; i < count && !result.IsEmpty(); ++i)
+        result = result.Tail();
+    return result;
+}
+
+template <class T>
+LazyStream<T> LazyStream<T>::Reverse() const {
+    LazyStream<T> result;
+    for (LazyStream<T> cur = *this; !cur.IsEmpty(); cur = cur.Tail())
+        result = Cons(cur.GetFirst(), result);
+    return result;
+}
+
+template <class T>
+LazyStream<T> LazyStream<T>::Append(const LazyStream<T>& other) const {
+    LazyStream<T> self = *this;
+    return Lazy([self, other]() {
+        if (self.IsEmpty()) return other;
+        return Cons(self.GetFirst(), self.Tail().Append(other));
+    });
+}
+
+template <class T>
+template <class F>
+void LazyStream<T>::ForEach(F&& func) const {
+    for (LazyStream<T> cur = *this; !cur.IsEmpty(); cur = cur.Tail())
+        func(cur.cell->head);
+}
@@ -29,6 +29,7 @@ public:
     T Get(int index) const;
     LinkedList<T>* GetSubList(int startIndex, int endIndex) const;
     int GetLength() const;
+    void CopyTo(T* out, int start, int count) const;
 
     void Append(T item);
     void Prepend(T item);
@@ -43,7 +44,22 @@ public:
             current = current->next;
         return current->data;
     }
-    
+
+    // Последовательный обход без повторного прохода от головы на каждый элемент
+    class ConstIterator {
+    private:
+        const Node* node;
+    public:
+        explicit ConstIterator(const Node* node) : node(node) {}
+        const T& operator*() const { return node->data; }
+        const T* operator->() const { return &node->data; }
+        ConstIterator& operator++() { node = node->next; return *this; }
+        bool operator==(const ConstIterator& other) const { return node == other.node; }
+        bool operator!=(const ConstIterator& other) const { return node != other.node; }
+    };
+
+    ConstIterator begin() const { return ConstIterator(root); }
+    ConstIterator end() const { return ConstIterator(nullptr); }
 };
 
 
@@ -133,13 +149,7 @@ T LinkedList<T>::GetLast() const{
         throw Errors::EmptyList();
     }
 
-    Node* cur = root;
-
-    while (cur->next != nullptr){
-        cur = cur->next;
-    }
-
-    return cur->data;
+    return tail->data;
 }
 
 template <class T>
@@ -196,6 +206,18 @@ int LinkedList<T>::GetLength() const{
     return size;
 }
 
+template <class T>
+void LinkedList<T>::CopyTo(T* out, int start, int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    if (start < 0 || start + count > size) throw Errors::InvalidIndices();
+
+    Node* cur = root;
+    for (int i = 0; i < start; i++)
+        cur = cur->next;
+    for (int i = 0; i < count; i++, cur = cur->next)
+        out[i] = cur->data;
+}
+
 template <class T>
 void LinkedList<T>::Append(T item){
    
@@ -203,12 +225,7 @@ void LinkedList<T>::Append(T item){
     if(root == nullptr){
         root = newNode;      
     }else{
-        Node* cur = root;
-        while (cur->next != nullptr)
-        {
-            cur = cur->next;
-        }
-        cur->next = newNode;
+        tail->next = newNode;
     }
     tail = newNode;
     size++;
@@ -218,6 +235,9 @@ template <class T>
 void LinkedList<T>::Prepend(T item){
     Node* newNode = new Node{item, root};
     root = newNode;
+    if(tail == nullptr){
+        tail = newNode;
+    }
     size++;
 }
 
@@ -239,6 +259,9 @@ void LinkedList<T>::InsertAt(T item, int index){
         cur->next = newNode;
         newNode->next = tmp;
     }
+    if(index == size){
+        tail = newNode;
+    }
     size++;
 }
 
@@ -254,6 +277,9 @@ void LinkedList<T>::Remove(int index){
     if(index == 0){
         root = cur->next;
         delete(cur);
+        if(root == nullptr){
+            tail = nullptr;
+        }
     }else{
         for(int i=0; i<index-1; i++){
             cur = cur->next;
@@ -261,13 +287,17 @@ void LinkedList<T>::Remove(int index){
         tmp = cur->next;
         cur->next=tmp->next;
         delete(tmp);
+        if(cur->next == nullptr){
+            tail = cur;
+        }
     }
     size--;
 }
 
 template <class T>
 LinkedList<T>* LinkedList<T>::Concat(const LinkedList<T>* list){
-/*     if (list == nullptr) throw Errors::NullList();
+    // Узлы list копируются: общие узлы у двух списков приводили к двойному удалению
+    if (list == nullptr) throw Errors::NullList();
 
     LinkedList<T>* result = new LinkedList<T>(*this);
     Node* cur = list->root;
@@ -275,13 +305,5 @@ LinkedList<T>* LinkedList<T>::Concat(const LinkedList<T>* list){
         result->Append(cur->data);
         cur = cur->next;
     }
-    return result;   */
-    if (list == nullptr) throw Errors::NullList();
-    
-    LinkedList<T>* result = new LinkedList<T>(*this);
-    result->tail->next = list->root;
-
-    result->size += list->size;
-    result->tail = list->tail;
     return result;
 }
@@ -2,18 +2,28 @@
 
 #include "sequence.hpp"
 #include "linked_list.hpp"
+#include "static_sequence.hpp"
 #include "errors.hpp"
 #include <stdexcept>
+#include <type_traits>
 
 // Изменяемая версия — базовый класс
 template <typename T>
 class MutableListSequence : public Sequence<T> {
+    template <typename> friend class MutableListSequence;
+
 protected:
     LinkedList<T>* list;
 
+    // Забирает владение готовым списком без копирования
+    explicit MutableListSequence(LinkedList<T>* ownedList);
+
     Sequence<T>* CreateFromList(LinkedList<T>* list) const;
 
 public:
+    template <class F>
+    using MapResult = std::decay_t<std::invoke_result_t<F&, const T&>>;
+
     MutableListSequence();
     MutableListSequence(T* items, int count);
     MutableListSequence(const MutableListSequence<T>& other);
@@ -24,6 +34,8 @@ public:
     T GetLast() const override;
     T Get(int index) const override;
     int GetLength() const override;
+    void CopyTo(T* out, int start, int count) const override;
+    void VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const override;
 
     Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
     Sequence<T>* Concat(const Sequence<T>* other) const override;
@@ -35,6 +47,19 @@ public:
 
     Sequence<T>* Instance() override;
     Sequence<T>* Clone() const override;
+
+    // Статическое представление: доступ без виртуальных вызовов
+    ListSequenceView<T> View() const;
+
+    // Преобразования принимают любые вызываемые объекты и возвращают новую последовательность
+    template <class F>
+    auto Map(F&& func) const -> MutableListSequence<MapResult<F>>;
+    template <class P>
+    MutableListSequence<T> Where(P&& predicate) const;
+    template <class F>
+    T Reduce(F&& func) const;
+    template <class A, class F>
+    A Reduce(F&& func, A init) const;
 };
 
 // Реализация MutableListSequence
@@ -43,6 +68,9 @@ MutableListSequence<T>::MutableListSequence() {
     list = new LinkedList<T>();
 }
 
+template <typename T>
+MutableListSequence<T>::MutableListSequence(LinkedList<T>* ownedList) : list(ownedList) {}
+
 template <typename T>
 MutableListSequence<T>::MutableListSequence(T* items, int count) {
     list = new LinkedList<T>(items, count);
@@ -65,17 +93,17 @@ MutableListSequence<T>::~MutableListSequence() {
 
 template <typename T>
 T MutableListSequence<T>::GetFirst() const {
-    return list->GetFirst();
+    return View().GetFirst();
 }
 
 template <typename T>
 T MutableListSequence<T>::GetLast() const {
-    return list->GetLast();
+    return View().GetLast();
 }
 
 template <typename T>
 T MutableListSequence<T>::Get(int index) const {
-    return list->Get(index);
+    return View().Get(index);
 }
 
 template <typename T>
@@ -83,6 +111,18 @@ int MutableListSequence<T>::GetLength() const {
     return list->GetLength();
 }
 
+template <typename T>
+void MutableListSequence<T>::CopyTo(T* out, int start, int count) const {
+    list->CopyTo(out, start, count);
+}
+
+// Каждый узел — отдельный кусок длины 1
+template <typename T>
+void MutableListSequence<T>::VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const {
+    for (const T& item : *list)
+        if (!visit(context, &item, 1)) return;
+}
+
 template <typename T>
 Sequence<T>* MutableListSequence<T>::GetSubsequence(int startIndex, int endIndex) const {
     LinkedList<T>* sub = list->GetSubList(startIndex, endIndex);
@@ -96,7 +136,9 @@ Sequence<T>* MutableListSequence<T>::Concat(const Sequence<T>* other) const {
     auto otherList = dynamic_cast<const MutableListSequence<T>*>(other);
     if (!otherList) throw Errors::IncompatibleTypes();
     LinkedList<T>* result = list->Concat(otherList->list);
-    return CreateFromList(result);
+    Sequence<T>* sequence = CreateFromList(result);
+    delete result;
+    return sequence;
 }
 
 template <typename T>
@@ -134,6 +176,48 @@ Sequence<T>* MutableListSequence<T>::Clone() const {
     return new MutableListSequence<T>(*this);
 }
 
+template <typename T>
+ListSequenceView<T> MutableListSequence<T>::View() const {
+    return ListSequenceView<T>(*list);
+}
+
+template <typename T>
+template <class F>
+auto MutableListSequence<T>::Map(F&& func) const -> MutableListSequence<MapResult<F>> {
+    auto* result = new LinkedList<MapResult<F>>();
+    for (const T& item : *list)
+        result->Append(func(item));
+    return MutableListSequence<MapResult<F>>(result);
+}
+
+template <typename T>
+template <class P>
+MutableListSequence<T> MutableListSequence<T>::Where(P&& predicate) const {
+    auto* result = new LinkedList<T>();
+    for (const T& item : *list)
+        if (Keeps(predicate, item)) result->Append(item);
+    return MutableListSequence<T>(result);
+}
+
+template <typename T>
+template <class F>
+T MutableListSequence<T>::Reduce(F&& func) const {
+    if (list->GetLength() == 0) throw Errors::EmptyList();
+    auto it = list->begin();
+    T result = *it;
+    for (++it; it != list->end(); ++it)
+        result = func(result, *it);
+    return result;
+}
+
+template <typename T>
+template <class A, class F>
+A MutableListSequence<T>::Reduce(F&& func, A init) const {
+    for (const T& item : *list)
+        init = func(init, item);
+    return init;
+}
+
 template <typename T>
 Sequence<T>* MutableListSequence<T>::CreateFromList(LinkedList<T>* list) const {
     return new MutableListSequence<T>(*list);
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "queue.hpp"
+#include "dynamic_array.hpp"
+#include "errors.hpp"
+
+// Ограниченная lock-free очередь для многих производителей и потребителей
+// (схема Вьюкова). У каждой ячейки есть номер sequence: ячейка свободна для
+// записи с позиции pos, когда sequence == pos, и готова к чтению, когда
+// sequence == pos + 1. Производитель занимает позицию CAS-ом по enqueuePos,
+// потребитель — по dequeuePos; сами данные передаются через release/acquire
+// на sequence ячейки, так что конкурирующие потоки не ждут друг друга.
+// TryEnqueue, TryDequeue, Enqueue, Dequeue, Clear и GetLength безопасны из
+// любых потоков. Peek, Get, GetFirst, GetLast, Map, Where и Reduce читают ячейки
+// напрямую и допустимы, только пока очередью больше никто не пользуется.
+template <class T>
+class MpmcQueue : public Queue<T> {
+private:
+    static constexpr std::size_t CacheLine = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    alignas(CacheLine) DynamicArray<Cell>* cells;
+    std::size_t mask;
+    // Where интерфейса Queue переставляет позиции из const-метода
+    alignas(CacheLine) mutable std::atomic<std::size_t> enqueuePos;
+    alignas(CacheLine) std::atomic<std::size_t> dequeuePos;
+
+    Cell& CellAt(std::size_t position) const { return cells->GetData()[position & mask]; }
+    // Элемент с номером index от головы; только без конкурентного доступа
+    T& Quiescent(int index) const;
+
+public:
+    explicit MpmcQueue(int capacity = 1024);
+    MpmcQueue(const MpmcQueue<T>&) = delete;
+    MpmcQueue<T>& operator=(const MpmcQueue<T>&) = delete;
+    ~MpmcQueue() override;
+
+    // Не блокируют: false — очередь полна или пуста в момент попытки
+    bool TryEnqueue(const T& item);
+    bool TryDequeue(T& out);
+
+    void Enqueue(const T& item) override;
+    T Dequeue() override;
+    T Peek() const override;
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+
+    int GetLength() const override;
+    bool IsEmpty() const override;
+    int GetCapacity() const;
+
+    void Clear() override;
+
+    void Map(void (*func)(T&)) const override;
+    void Where(bool (*func)(T&)) const override;
+    T Reduce(T (*func)(const T&, const T&)) const override;
+};
+
+template <class T>
+MpmcQueue<T>::MpmcQueue(int capacity) : enqueuePos(0), dequeuePos(0) {
+    if (capacity < 0) throw Errors::NegativeSize();
+    int rounded = 2;
+    while (rounded < capacity) rounded *= 2;
+    cells = new DynamicArray<Cell>(rounded);
+    mask = static_cast<std::size_t>(rounded) - 1;
+    for (int i = 0; i < rounded; ++i)
+        cells->GetData()[i].sequence.store(static_cast<std::size_t>(i), std::memory_order_relaxed);
+}
+
+template <class T>
+MpmcQueue<T>::~MpmcQueue() {
+    delete cells;
+}
+
+template <class T>
+bool MpmcQueue<T>::TryEnqueue(const T& item) {
+    std::size_t position = enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &CellAt(position);
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false; // ячейку ещё не освободил потребитель: очередь полна
+        } else {
+            position = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->value = item;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+bool MpmcQueue<T>::TryDequeue(T& out) {
+    std::size_t position = dequeuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &CellAt(position);
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+        if (diff == 0) {
+            if (dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false; // производитель ещё не записал ячейку: очередь пуста
+        } else {
+            position = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+    out = std::move(cell->value);
+    if constexpr (!std::is_trivially_destructible_v<T>) cell->value = T();
+    cell->sequence.store(position + mask + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+void MpmcQueue<T>::Enqueue(const T& item) {
+    if (!TryEnqueue(item)) throw Errors::Full();
+}
+
+template <class T>
+T MpmcQueue<T>::Dequeue() {
+    T item;
+    if (!TryDequeue(item)) throw Errors::EmptyArray();
+    return item;
+}
+
+template <class T>
+T& MpmcQueue<T>::Quiescent(int index) const {
+    if (index < 0 || index >= GetLength()) throw Errors::IndexOutOfRange();
+    return CellAt(dequeuePos.load(std::memory_order_acquire) + index).value;
+}
+
+template <class T>
+T MpmcQueue<T>::Peek() const {
+    return GetFirst();
+}
+
+template <class T>
+T MpmcQueue<T>::GetFirst() const {
+    if (IsEmpty()) throw Errors::EmptyArray();
+    return Quiescent(0);
+}
+
+template <class T>
+T MpmcQueue<T>::GetLast() const {
+    if (IsEmpty()) throw Errors::EmptyArray();
+    return Quiescent(GetLength() - 1);
+}
+
+template <class T>
+T MpmcQueue<T>::Get(int index) const {
+    return Quiescent(index);
+}
+
+// Снимок: при одновременной работе может тут же устареть
+template <class T>
+int MpmcQueue<T>::GetLength() const {
+    std::size_t first = dequeuePos.load(std::memory_order_acquire);
+    std::size_t last = enqueuePos.load(std::memory_order_acquire);
+    return last > first ? static_cast<int>(last - first) : 0;
+}
+
+template <class T>
+bool MpmcQueue<T>::IsEmpty() const {
+    return GetLength() == 0;
+}
+
+template <class T>
+int MpmcQueue<T>::GetCapacity() const {
+    return static_cast<int>(mask + 1);
+}
+
+template <class T>
+void MpmcQueue<T>::Clear() {
+    T item;
+    while (TryDequeue(item)) {}
+}
+
+template <class T>
+void MpmcQueue<T>::Map(void (*func)(T&)) const {
+    for (int i = 0; i < GetLength(); ++i) func(Quiescent(i));
+}
+
+// Уплотнение к голове; освободившиеся ячейки получают номера для новой записи
+template <class T>
+void MpmcQueue<T>::Where(bool (*func)(T&)) const {
+    std::size_t first = dequeuePos.load(std::memory_order_acquire);
+    std::size_t last = enqueuePos.load(std::memory_order_acquire);
+    std::size_t kept = first;
+    for (std::size_t i = first; i < last; ++i) {
+        T& item = CellAt(i).value;
+        if (!func(item)) continue;
+        if (kept != i) CellAt(kept).value = std::move(item);
+        CellAt(kept).sequence.store(kept + 1, std::memory_order_relaxed);
+        ++kept;
+    }
+    for (std::size_t i = kept; i < last; ++i) {
+        if constexpr (!std::is_trivially_destructible_v<T>) CellAt(i).value = T();
+        CellAt(i).sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueuePos.store(kept, std::memory_order_release);
+}
+
+template <class T>
+T MpmcQueue<T>::Reduce(T (*func)(const T&, const T&)) const {
+    int length = GetLength();
+    if (length == 0) throw Errors::EmptyArray();
+    T result = Quiescent(0);
+    for (int i = 1; i < length; ++i) result = func(result, Quiescent(i));
+    return result;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "errors.hpp"
+
+// Неизменяемый односвязный список с разделением структуры.
+// Каждая "модификация" возвращает новый список, который делит хвост со старым,
+// поэтому копия списка (снимок) стоит O(1) времени и памяти.
+template <class T>
+class PersistentList {
+private:
+    struct Node {
+        T data;
+        mutable std::shared_ptr<const Node> next; // mutable только ради итеративного удаления
+        Node(const T& data, std::shared_ptr<const Node> next) : data(data), next(std::move(next)) {}
+    };
+
+    std::shared_ptr<const Node> root;
+    int size;
+
+    PersistentList(std::shared_ptr<const Node> root, int size);
+
+public:
+    PersistentList();
+    PersistentList(const PersistentList<T>& other) = default;
+    PersistentList(PersistentList<T>&& other) noexcept;
+    ~PersistentList();
+
+    PersistentList<T>& operator=(PersistentList<T> other) noexcept;
+
+    T GetFirst() const;
+    int GetLength() const;
+    bool IsEmpty() const;
+
+    PersistentList<T> Prepend(const T& item) const;
+    PersistentList<T> Tail() const;
+    PersistentList<T> Reverse() const;
+
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+template <class T>
+PersistentList<T>::PersistentList() : root(nullptr), size(0) {}
+
+template <class T>
+PersistentList<T>::PersistentList(std::shared_ptr<const Node> root, int size)
+    : root(std::move(root)), size(size) {}
+
+template <class T>
+PersistentList<T>::PersistentList(PersistentList<T>&& other) noexcept
+    : root(std::move(other.root)), size(other.size) {
+    other.size = 0;
+}
+
+// Рекурсивный деструктор shared_ptr переполнил бы стек на длинных списках,
+// поэтому освобождаем узлы, которыми владеем единолично, в цикле
+template <class T>
+PersistentList<T>::~PersistentList() {
+    std::shared_ptr<const Node> cur = std::move(root);
+    while (cur && cur.use_count() == 1) {
+        std::shared_ptr<const Node> next = std::move(cur->next);
+        cur = std::move(next);
+    }
+}
+
+template <class T>
+PersistentList<T>& PersistentList<T>::operator=(PersistentList<T> other) noexcept {
+    std::swap(root, other.root);
+    std::swap(size, other.size);
+    return *this;
+}
+
+template <class T>
+T PersistentList<T>::GetFirst() const {
+    if (!root) throw Errors::EmptyList();
+    return root->data;
+}
+
+template <class T>
+int PersistentList<T>::GetLength() const {
+    return size;
+}
+
+template <class T>
+bool PersistentList<T>::IsEmpty() const {
+    return size == 0;
+}
+
+template <class T>
+PersistentList<T> PersistentList<T>::Prepend(const T& item) const {
+    return PersistentList<T>(std::make_shared<const Node>(item, root), size + 1);
+}
+
+template <class T>
+PersistentList<T> PersistentList<T>::Tail() const {
+    if (!root) throw Errors::EmptyList();
+    return PersistentList<T>(root->next, size - 1);
+}
+
+template <class T>
+PersistentList<T> PersistentList<T>::Reverse() const {
+    PersistentList<T> result;
+    for (const Node* cur = root.get(); cur != nullptr; cur = cur->next.get())
+        result = result.Prepend(cur->data);
+    return result;
+}
+
+template <class T>
+template <class F>
+void PersistentList<T>::ForEach(F&& func) const {
+    for (const Node* cur = root.get(); cur != nullptr; cur = cur->next.get())
+        func(cur->data);
+}
+
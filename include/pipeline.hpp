@@ -0,0 +1,172 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "sequence.hpp"
+#include "errors.hpp"
+
+// Ленивый конвейер преобразований: seq.Pipe().Map(f).Where(p).Take(n).Reduce(r).
+// Стадии — это обёртки-функторы без выделения памяти; все они склеиваются
+// в один проход по исходной последовательности, который останавливается,
+// как только потребителю больше не нужны элементы.
+//
+// Producer — объект с методом operator()(Sink&& sink), который подаёт элементы
+// в sink(const T&) до тех пор, пока тот возвращает true.
+
+template <class T>
+class SequenceSource {
+private:
+    const Sequence<T>* sequence;
+
+public:
+    explicit SequenceSource(const Sequence<T>* sequence) : sequence(sequence) {}
+
+    template <class Sink>
+    void operator()(Sink&& sink) const;
+};
+
+template <class T, class Source, class F>
+struct MapStage {
+    Source source;
+    F func;
+
+    template <class Sink>
+    void operator()(Sink&& sink) const {
+        source([&](const T& item) { return sink(func(item)); });
+    }
+};
+
+template <class T, class Source, class P>
+struct WhereStage {
+    Source source;
+    P predicate;
+
+    template <class Sink>
+    void operator()(Sink&& sink) const {
+        source([&](const T& item) { return !predicate(item) || sink(item); });
+    }
+};
+
+template <class T, class Source>
+struct TakeStage {
+    Source source;
+    int count;
+
+    template <class Sink>
+    void operator()(Sink&& sink) const {
+        if (count <= 0) return;
+        int taken = 0;
+        source([&](const T& item) { return sink(item) && ++taken < count; });
+    }
+};
+
+
+template <class T, class Producer>
+class Pipeline {
+private:
+    Producer producer;
+
+public:
+    template <class F>
+    using MapResult = std::decay_t<std::invoke_result_t<const F&, const T&>>;
+
+    explicit Pipeline(Producer producer) : producer(std::move(producer)) {}
+
+    template <class F>
+    auto Map(F func) const -> Pipeline<MapResult<F>, MapStage<T, Producer, F>>;
+    template <class P>
+    Pipeline<T, WhereStage<T, Producer, P>> Where(P predicate) const;
+    Pipeline<T, TakeStage<T, Producer>> Take(int count) const;
+
+    template <class F>
+    T Reduce(F func) const;
+    template <class A, class F>
+    A Reduce(F func, A init) const;
+    int Count() const;
+    template <class F>
+    void ForEach(F func) const;
+    void CollectTo(Sequence<T>& target) const;
+};
+
+template <class T>
+template <class Sink>
+void SequenceSource<T>::operator()(Sink&& sink) const {
+    using SinkType = std::remove_reference_t<Sink>;
+    sequence->VisitChunks([](void* context, const T* chunk, int length) {
+        SinkType& target = *static_cast<SinkType*>(context);
+        for (int i = 0; i < length; ++i)
+            if (!target(chunk[i])) return false;
+        return true;
+    }, static_cast<void*>(&sink));
+}
+
+template <class T, class Producer>
+template <class F>
+auto Pipeline<T, Producer>::Map(F func) const -> Pipeline<MapResult<F>, MapStage<T, Producer, F>> {
+    return Pipeline<MapResult<F>, MapStage<T, Producer, F>>(MapStage<T, Producer, F>{producer, std::move(func)});
+}
+
+template <class T, class Producer>
+template <class P>
+Pipeline<T, WhereStage<T, Producer, P>> Pipeline<T, Producer>::Where(P predicate) const {
+    return Pipeline<T, WhereStage<T, Producer, P>>(WhereStage<T, Producer, P>{producer, std::move(predicate)});
+}
+
+template <class T, class Producer>
+Pipeline<T, TakeStage<T, Producer>> Pipeline<T, Producer>::Take(int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    return Pipeline<T, TakeStage<T, Producer>>(TakeStage<T, Producer>{producer, count});
+}
+
+template <class T, class Producer>
+template <class F>
+T Pipeline<T, Producer>::Reduce(F func) const {
+    bool hasValue = false;
+    T result{};
+    producer([&](const T& item) {
+        if (hasValue) {
+            result = func(result, item);
+        } else {
+            result = item;
+            hasValue = true;
+        }
+        return true;
+    });
+    if (!hasValue) throw Errors::EmptyValue();
+    return result;
+}
+
+template <class T, class Producer>
+template <class A, class F>
+A Pipeline<T, Producer>::Reduce(F func, A init) const {
+    producer([&](const T& item) {
+        init = func(init, item);
+        return true;
+    });
+    return init;
+}
+
+template <class T, class Producer>
+int Pipeline<T, Producer>::Count() const {
+    int count = 0;
+    producer([&count](const T&) { ++count; return true; });
+    return count;
+}
+
+template <class T, class Producer>
+template <class F>
+void Pipeline<T, Producer>::ForEach(F func) const {
+    producer([&func](const T& item) { func(item); return true; });
+}
+
+template <class T, class Producer>
+void Pipeline<T, Producer>::CollectTo(Sequence<T>& target) const {
+    producer([&target](const T& item) { target.Append(item); return true; });
+}
+
+
+template <class T>
+Pipeline<T, SequenceSource<T>> Sequence<T>::Pipe() const {
+    return Pipeline<T, SequenceSource<T>>(SequenceSource<T>(this));
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
 #include "array_sequence.hpp"
 #include "list_sequence.hpp"
 #include "errors.hpp"
@@ -28,12 +32,35 @@ public:
 };
 
 
+// Очередь на кольцевом буфере: ёмкость — степень двойки, позиция элемента i —
+// (head + i) & mask. Enqueue, Dequeue, Peek и Get — O(1) (Enqueue амортизированно),
+// элементы никогда не сдвигаются при извлечении. При заполнении буфер удваивается,
+// а содержимое переписывается с нуля в порядке очереди.
 template <class T>
-class ArrayQueue : public MutableArraySequence<T>, public Queue<T> {
+class ArrayQueue : public Sequence<T>, public Queue<T> {
+    template <typename> friend class ArrayQueue;
+
+private:
+    static constexpr int MinCapacity = 8;
+
+    DynamicArray<T>* buffer;
+    int head;
+    // Where интерфейса Queue уплотняет очередь из const-метода
+    mutable int count;
+
+    int Mask() const { return buffer->GetSize() - 1; }
+    T& Slot(int index) const { return buffer->GetData()[(head + index) & Mask()]; }
+    void ResetSlot(int index) const;
+    void Reserve(int minCapacity);
+
 public:
+    template <class F>
+    using MapResult = std::decay_t<std::invoke_result_t<F&, const T&>>;
+
     ArrayQueue();
     ArrayQueue(T* items, int count);
     ArrayQueue(const ArrayQueue<T>& other);
+    ArrayQueue<T>& operator=(ArrayQueue<T> other);
     ~ArrayQueue() override;
 
     void Enqueue(const T& item) override;
@@ -46,126 +73,352 @@ public:
 
     int GetLength() const override;
     bool IsEmpty() const override;
+    int GetCapacity() const;
+
+    // Не более двух кусков: до конца буфера и с его начала
+    void CopyTo(T* out, int start, int count) const override;
+    void VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const override;
+
+    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
 
     void Clear() override;
 
     void Map(void (*func)(T&)) const override;
     void Where(bool (*func)(T&)) const override;
     T Reduce(T (*func)(const T&, const T&)) const override;
+    // Любые вызываемые объекты, как у последовательностей; результат — новая очередь.
+    // Where с лямбдой никогда не меняет очередь, на месте фильтрует только версия
+    // интерфейса Queue с указателем на функцию
+    template <class F>
+    auto Map(F&& func) const -> ArrayQueue<MapResult<F>>;
+    template <class P>
+    ArrayQueue<T> Where(P&& predicate) const;
+    template <class F>
+    T Reduce(F&& func) const;
+    template <class A, class F>
+    A Reduce(F&& func, A init) const;
 
     ArrayQueue<T> Concat(const ArrayQueue<T>& other) const;
     ArrayQueue<T> Clutch(const ArrayQueue<T>& other) const;
 
     ArrayQueue<T> GetSubQueue(int startIndex, int endIndex) const;
-
-    
 };
 
 template <typename T>
-ArrayQueue<T>::ArrayQueue() : MutableArraySequence<T>() {}
+ArrayQueue<T>::ArrayQueue() : buffer(new DynamicArray<T>(0)), head(0), count(0) {}
 
 template <typename T>
-ArrayQueue<T>::ArrayQueue(T* items, int count) : MutableArraySequence<T>(items, count) {}
+ArrayQueue<T>::ArrayQueue(T* items, int count) : ArrayQueue() {
+    if (count < 0) throw Errors::NegativeCount();
+    Reserve(count);
+    std::copy(items, items + count, buffer->GetData());
+    this->count = count;
+}
+
+template <typename T>
+ArrayQueue<T>::ArrayQueue(const ArrayQueue<T>& other) : ArrayQueue() {
+    Reserve(other.count);
+    other.CopyTo(buffer->GetData(), 0, other.count);
+    count = other.count;
+}
+
+template <typename T>
+ArrayQueue<T>& ArrayQueue<T>::operator=(ArrayQueue<T> other) {
+    std::swap(buffer, other.buffer);
+    std::swap(head, other.head);
+    std::swap(count, other.count);
+    return *this;
+}
 
 template <typename T>
-ArrayQueue<T>::ArrayQueue(const ArrayQueue<T>& other) : MutableArraySequence<T>(other) {}
+ArrayQueue<T>::~ArrayQueue() {
+    delete buffer;
+}
 
+// Освободившаяся ячейка не держит ресурсы извлечённого элемента
 template <typename T>
-ArrayQueue<T>::~ArrayQueue() = default;
+void ArrayQueue<T>::ResetSlot(int index) const {
+    if constexpr (!std::is_trivially_destructible_v<T>) Slot(index) = T();
+}
+
+// Ёмкость — наименьшая степень двойки не меньше minCapacity; голова переезжает в 0
+template <typename T>
+void ArrayQueue<T>::Reserve(int minCapacity) {
+    if (minCapacity <= buffer->GetSize()) return;
+    int capacity = MinCapacity;
+    while (capacity < minCapacity) capacity *= 2;
+    auto* grown = new DynamicArray<T>(capacity);
+    T* target = grown->GetData();
+    for (int i = 0; i < count; ++i)
+        target[i] = std::move(Slot(i));
+    delete buffer;
+    buffer = grown;
+    head = 0;
+}
 
 template <typename T>
 void ArrayQueue<T>::Enqueue(const T& item) {
-    this->Append(item);
+    if (count == buffer->GetSize()) Reserve(count + 1);
+    Slot(count) = item;
+    ++count;
 }
 
 template <typename T>
 T ArrayQueue<T>::Dequeue() {
-    if (this->IsEmpty()) throw Errors::EmptyArray();
-    T value = this->GetFirst();
-    this->Remove(0);
+    if (count == 0) throw Errors::EmptyArray();
+    T value = std::move(Slot(0));
+    ResetSlot(0);
+    head = (head + 1) & Mask();
+    --count;
     return value;
 }
 
 template <typename T>
 T ArrayQueue<T>::Peek() const {
-    return this->GetFirst();
+    return GetFirst();
 }
 
 template <typename T>
 T ArrayQueue<T>::GetFirst() const {
-    return MutableArraySequence<T>::GetFirst();
+    if (count == 0) throw Errors::EmptyArray();
+    return Slot(0);
 }
 
 template <typename T>
 T ArrayQueue<T>::GetLast() const {
-    return MutableArraySequence<T>::GetLast();
+    if (count == 0) throw Errors::EmptyArray();
+    return Slot(count - 1);
 }
 
 template <typename T>
 T ArrayQueue<T>::Get(int index) const {
-    return MutableArraySequence<T>::Get(index);
+    if (index < 0 || index >= count) throw Errors::IndexOutOfRange();
+    return Slot(index);
 }
 
 template <typename T>
 int ArrayQueue<T>::GetLength() const {
-    return MutableArraySequence<T>::GetLength();
+    return count;
 }
 
 template <typename T>
 bool ArrayQueue<T>::IsEmpty() const {
-    return this->GetLength() == 0;
+    return count == 0;
+}
+
+template <typename T>
+int ArrayQueue<T>::GetCapacity() const {
+    return buffer->GetSize();
+}
+
+template <typename T>
+void ArrayQueue<T>::CopyTo(T* out, int start, int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    if (start < 0 || start + count > this->count) throw Errors::InvalidIndices();
+    if (count == 0) return;
+    const T* data = buffer->GetData();
+    int first = (head + start) & Mask();
+    int tail = std::min(count, buffer->GetSize() - first);
+    std::copy(data + first, data + first + tail, out);
+    std::copy(data, data + count - tail, out + tail);
+}
+
+template <typename T>
+void ArrayQueue<T>::VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const {
+    if (count == 0) return;
+    const T* data = buffer->GetData();
+    int tail = std::min(count, buffer->GetSize() - head);
+    if (!visit(context, data + head, tail)) return;
+    if (tail < count) visit(context, data, count - tail);
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::GetSubsequence(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= count || startIndex > endIndex)
+        throw Errors::InvalidIndices();
+    auto* result = new ArrayQueue<T>();
+    int length = endIndex - startIndex + 1;
+    result->Reserve(length);
+    CopyTo(result->buffer->GetData(), startIndex, length);
+    result->count = length;
+    return result;
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::Concat(const Sequence<T>* other) const {
+    if (!other) throw Errors::NullList();
+    auto* result = new ArrayQueue<T>(*this);
+    int length = other->GetLength();
+    result->Reserve(count + length);
+    DynamicArray<T> tail(length);
+    other->CopyTo(tail.GetData(), 0, length);
+    for (int i = 0; i < length; ++i) result->Enqueue(tail.GetData()[i]);
+    return result;
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::Append(T item) {
+    Enqueue(item);
+    return this;
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::Prepend(T item) {
+    if (count == buffer->GetSize()) Reserve(count + 1);
+    head = (head - 1) & Mask();
+    Slot(0) = item;
+    ++count;
+    return this;
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::InsertAt(T item, int index) {
+    if (index < 0 || index > count) throw Errors::IndexOutOfRange();
+    if (count == buffer->GetSize()) Reserve(count + 1);
+    for (int i = count; i > index; --i)
+        Slot(i) = std::move(Slot(i - 1));
+    Slot(index) = item;
+    ++count;
+    return this;
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::Remove(int index) {
+    if (count == 0) throw Errors::EmptyArray();
+    if (index < 0 || index >= count) throw Errors::IndexOutOfRange();
+    for (int i = index; i < count - 1; ++i)
+        Slot(i) = std::move(Slot(i + 1));
+    ResetSlot(count - 1);
+    --count;
+    return this;
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::Instance() {
+    return this;
+}
+
+template <typename T>
+Sequence<T>* ArrayQueue<T>::Clone() const {
+    return new ArrayQueue<T>(*this);
 }
 
+// Буфер сохраняется для повторного заполнения
 template <typename T>
 void ArrayQueue<T>::Clear() {
-    delete this->items;
-    this->items = new DynamicArray<T>(0);
+    for (int i = 0; i < count; ++i) ResetSlot(i);
+    head = 0;
+    count = 0;
 }
 
 template <typename T>
 void ArrayQueue<T>::Map(void (*func)(T&)) const {
-    for (int i = 0; i < this->GetLength(); ++i) {
-        func(this->items->GetRef(i));
-    }
+    for (int i = 0; i < count; ++i)
+        func(Slot(i));
 }
 
+// Оставшиеся элементы уплотняются к голове за один проход
 template <typename T>
 void ArrayQueue<T>::Where(bool (*func)(T&)) const {
-    for (int i = 0; i < this->GetLength(); ++i) {
-        if (!func(this->items->GetRef(i))) {
-            this->items->Remove(i--);
-        }
+    int kept = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!func(Slot(i))) continue;
+        if (kept != i) Slot(kept) = std::move(Slot(i));
+        ++kept;
     }
+    for (int i = kept; i < count; ++i) ResetSlot(i);
+    count = kept;
 }
 
 template <typename T>
 T ArrayQueue<T>::Reduce(T (*func)(const T&, const T&)) const {
-    if (this->IsEmpty()) throw Errors::EmptyArray();
-    T result = this->Get(0);
-    for (int i = 1; i < this->GetLength(); ++i)
-        result = func(result, this->Get(i));
+    if (count == 0) throw Errors::EmptyArray();
+    T result = Slot(0);
+    for (int i = 1; i < count; ++i)
+        result = func(result, Slot(i));
+    return result;
+}
+
+template <typename T>
+template <class F>
+auto ArrayQueue<T>::Map(F&& func) const -> ArrayQueue<MapResult<F>> {
+    ArrayQueue<MapResult<F>> result;
+    result.Reserve(count);
+    auto* target = result.buffer->GetData();
+    for (int i = 0; i < count; ++i)
+        target[i] = func(std::as_const(Slot(i)));
+    result.count = count;
+    return result;
+}
+
+template <typename T>
+template <class P>
+ArrayQueue<T> ArrayQueue<T>::Where(P&& predicate) const {
+    ArrayQueue<T> result;
+    result.Reserve(count);
+    T* target = result.buffer->GetData();
+    for (int i = 0; i < count; ++i)
+        if (Keeps(predicate, std::as_const(Slot(i)))) target[result.count++] = Slot(i);
+    return result;
+}
+
+template <typename T>
+template <class F>
+T ArrayQueue<T>::Reduce(F&& func) const {
+    if (count == 0) throw Errors::EmptyArray();
+    T result = Slot(0);
+    for (int i = 1; i < count; ++i)
+        result = func(result, Slot(i));
     return result;
 }
 
+template <typename T>
+template <class A, class F>
+A ArrayQueue<T>::Reduce(F&& func, A init) const {
+    for (int i = 0; i < count; ++i)
+        init = func(init, Slot(i));
+    return init;
+}
+
 template <typename T>
 ArrayQueue<T> ArrayQueue<T>::Concat(const ArrayQueue<T>& other) const {
-    return *static_cast<ArrayQueue<T>*>(this->Concat(&other));
+    int len1 = this->GetLength();
+    int len2 = other.GetLength();
+    DynamicArray<T> joined(len1 + len2);
+    this->CopyTo(joined.GetData(), 0, len1);
+    other.CopyTo(joined.GetData() + len1, 0, len2);
+    return ArrayQueue<T>(joined.GetData(), len1 + len2);
 }
 
 template <typename T>
 ArrayQueue<T> ArrayQueue<T>::Clutch(const ArrayQueue<T>& other) const {
-    ArrayQueue<T> result;
     int len1 = this->GetLength();
     int len2 = other.GetLength();
     int minLen = std::min(len1, len2);
 
+    DynamicArray<T> first(len1);
+    DynamicArray<T> second(len2);
+    this->CopyTo(first.GetData(), 0, len1);
+    other.CopyTo(second.GetData(), 0, len2);
+
+    DynamicArray<T> merged(len1 + len2);
+    T* out = merged.GetData();
     for (int i = 0; i < minLen; ++i) {
-        result.Enqueue(this->Get(i));
-        result.Enqueue(other.Get(i));
+        *out++ = first.GetData()[i];
+        *out++ = second.GetData()[i];
     }
-    for (int i = minLen; i < len1; ++i) result.Enqueue(this->Get(i));
-    for (int i = minLen; i < len2; ++i) result.Enqueue(other.Get(i));
-    return result;
+    out = std::copy(first.GetData() + minLen, first.GetData() + len1, out);
+    std::copy(second.GetData() + minLen, second.GetData() + len2, out);
+    return ArrayQueue<T>(merged.GetData(), len1 + len2);
 }
 
 template <typename T>
@@ -202,6 +455,11 @@ public:
     void Map(void (*func)(T&)) const override;
     void Where(bool (*func)(T&)) const override;
     T Reduce(T (*func)(const T&, const T&)) const override;
+    // Переопределения выше иначе скрыли бы шаблонные версии последовательности;
+    // Where с лямбдой, как у ArrayQueue, возвращает новую последовательность
+    using MutableListSequence<T>::Map;
+    using MutableListSequence<T>::Where;
+    using MutableListSequence<T>::Reduce;
 
     ListQueue<T> Concat(const ArrayQueue<T>& other) const;
     ListQueue<T> Clutch(const ArrayQueue<T>& other) const;
@@ -236,32 +494,32 @@ T ListQueue<T>::Dequeue() {
 
 template <typename T>
 T ListQueue<T>::Peek() const {
-    return this->GetFirst();
+    return this->View().GetFirst();
 }
 
 template <typename T>
 T ListQueue<T>::GetFirst() const {
-    return MutableListSequence<T>::GetFirst();
+    return this->View().GetFirst();
 }
 
 template <typename T>
 T ListQueue<T>::GetLast() const {
-    return MutableListSequence<T>::GetLast();
+    return this->View().GetLast();
 }
 
 template <typename T>
 T ListQueue<T>::Get(int index) const {
-    return MutableListSequence<T>::Get(index);
+    return this->View().Get(index);
 }
 
 template <typename T>
 int ListQueue<T>::GetLength() const {
-    return MutableListSequence<T>::GetLength();
+    return this->View().GetLength();
 }
 
 template <typename T>
 bool ListQueue<T>::IsEmpty() const {
-    return this->GetLength() == 0;
+    return this->View().IsEmpty();
 }
 
 template <typename T>
@@ -297,26 +555,34 @@ T ListQueue<T>::Reduce(T (*func)(const T&, const T&)) const {
 
 template <typename T>
 ListQueue<T> ListQueue<T>::Concat(const ArrayQueue<T>& other) const {
-    ListQueue<T> result(*this);
-    for (int i = 0; i < other.GetLength(); ++i)
-        result.Enqueue(other.Get(i));
-    return result;
+    int len1 = this->GetLength();
+    int len2 = other.GetLength();
+    DynamicArray<T> joined(len1 + len2);
+    this->CopyTo(joined.GetData(), 0, len1);
+    other.CopyTo(joined.GetData() + len1, 0, len2);
+    return ListQueue<T>(joined.GetData(), len1 + len2);
 }
 
 template <typename T>
 ListQueue<T> ListQueue<T>::Clutch(const ArrayQueue<T>& other) const {
-    ListQueue<T> result;
     int len1 = this->GetLength();
     int len2 = other.GetLength();
     int minLen = std::min(len1, len2);
 
+    DynamicArray<T> first(len1);
+    DynamicArray<T> second(len2);
+    this->CopyTo(first.GetData(), 0, len1);
+    other.CopyTo(second.GetData(), 0, len2);
+
+    DynamicArray<T> merged(len1 + len2);
+    T* out = merged.GetData();
     for (int i = 0; i < minLen; ++i) {
-        result.Enqueue(this->Get(i));
-        result.Enqueue(other.Get(i));
+        *out++ = first.GetData()[i];
+        *out++ = second.GetData()[i];
     }
-    for (int i = minLen; i < len1; ++i) result.Enqueue(this->Get(i));
-    for (int i = minLen; i < len2; ++i) result.Enqueue(other.Get(i));
-    return result;
+    out = std::copy(first.GetData() + minLen, first.GetData() + len1, out);
+    std::copy(second.GetData() + minLen, second.GetData() + len2, out);
+    return ListQueue<T>(merged.GetData(), len1 + len2);
 }
 
 template <typename T>
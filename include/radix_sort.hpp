@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Поразрядная LSD-сортировка по байтам. Ключ переводится в беззнаковое
+// целое с тем же порядком (RadixTraits), после чего сортировка устойчива
+// и работает за O(n * sizeof(key)) без сравнений.
+namespace Sorting {
+
+    template <class K, class Enable = void>
+    struct RadixTraits;
+
+    // Для знаковых целых инвертируется старший бит, чтобы отрицательные шли первыми
+    template <class K>
+    struct RadixTraits<K, std::enable_if_t<std::is_integral_v<K> && !std::is_same_v<K, bool>>> {
+        using Bits = std::make_unsigned_t<K>;
+        static Bits Encode(K key) {
+            Bits bits = static_cast<Bits>(key);
+            if constexpr (std::is_signed_v<K>)
+                bits ^= Bits(1) << (sizeof(K) * 8 - 1);
+            return bits;
+        }
+    };
+
+    // IEEE 754: у отрицательных инвертируются все биты, у положительных — только знак
+    template <class K>
+    struct RadixTraits<K, std::enable_if_t<std::is_floating_point_v<K> && sizeof(K) == 8>> {
+        using Bits = std::uint64_t;
+        static Bits Encode(K key) {
+            Bits bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            const Bits sign = Bits(1) << 63;
+            return (bits & sign) ? ~bits : (bits | sign);
+        }
+    };
+
+    template <class K>
+    struct RadixTraits<K, std::enable_if_t<std::is_floating_point_v<K> && sizeof(K) == 4>> {
+        using Bits = std::uint32_t;
+        static Bits Encode(K key) {
+            Bits bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            const Bits sign = Bits(1) << 31;
+            return (bits & sign) ? ~bits : (bits | sign);
+        }
+    };
+
+    const int RadixDigits = 256;
+
+    // Основной цикл: encodedKey(item) возвращает уже закодированный ключ.
+    // Гистограммы всех разрядов строятся за один предварительный проход;
+    // разряды, где у всех ключей одна и та же цифра, пропускаются.
+    // scratch — буфер на count элементов, результат всегда оказывается в data.
+    template <class T, class EncodedKey>
+    void LsdRadixSort(T* data, T* scratch, int count, EncodedKey encodedKey) {
+        using Bits = std::decay_t<decltype(encodedKey(*data))>;
+        constexpr int Passes = sizeof(Bits);
+        if (count < 2) return;
+
+        int histogram[Passes][RadixDigits] = {};
+        for (int i = 0; i < count; ++i) {
+            Bits key = encodedKey(data[i]);
+            for (int pass = 0; pass < Passes; ++pass)
+                ++histogram[pass][(key >> (pass * 8)) & 0xFF];
+        }
+
+        T* from = data;
+        T* to = scratch;
+        Bits firstKey = encodedKey(data[0]);
+        for (int pass = 0; pass < Passes; ++pass) {
+            int shift = pass * 8;
+            int* counts = histogram[pass];
+            if (counts[(firstKey >> shift) & 0xFF] == count) continue;
+
+            int offset = 0;
+            for (int digit = 0; digit < RadixDigits; ++digit) {
+                int digitCount = counts[digit];
+                counts[digit] = offset;
+                offset += digitCount;
+            }
+            for (int i = 0; i < count; ++i)
+                to[counts[(encodedKey(from[i]) >> shift) & 0xFF]++] = std::move(from[i]);
+            std::swap(from, to);
+        }
+        if (from != data)
+            for (int i = 0; i < count; ++i)
+                data[i] = std::move(from[i]);
+    }
+
+    // Сортировка чисел (целых или с плавающей точкой) по их собственному значению
+    template <class T>
+    void RadixSort(T* data, T* scratch, int count) {
+        LsdRadixSort(data, scratch, count, [](const T& item) { return RadixTraits<T>::Encode(item); });
+    }
+
+    template <class Bits>
+    struct RadixEntry {
+        Bits key;
+        int index;
+    };
+
+    // Буфер пар (ключ, индекс) для RadixSortBy, переживающий вызовы: растёт только вверх.
+    // Пары тривиальны, поэтому хранятся в сырых 8-байтовых словах под любой тип ключа.
+    class RadixKeyBuffer {
+    private:
+        std::uint64_t* words = nullptr;
+        std::size_t capacity = 0;
+
+    public:
+        RadixKeyBuffer() = default;
+        RadixKeyBuffer(const RadixKeyBuffer&) = delete;
+        RadixKeyBuffer& operator=(const RadixKeyBuffer&) = delete;
+        ~RadixKeyBuffer() { delete[] words; }
+
+        template <class Entry>
+        Entry* Reserve(int count) {
+            static_assert(std::is_trivial_v<Entry> && alignof(Entry) <= alignof(std::uint64_t));
+            std::size_t needed = (static_cast<std::size_t>(count) * sizeof(Entry) + 7) / 8;
+            if (needed > capacity) {
+                delete[] words;
+                words = nullptr;
+                words = new std::uint64_t[needed];
+                capacity = needed;
+            }
+            return reinterpret_cast<Entry*>(words);
+        }
+    };
+
+    // Сортировка записей по ключу keyOf(item) (int, double и т.п.).
+    // Сортируются только пары (ключ, индекс), сами записи перемещаются один раз;
+    // scratch — буфер на count записей, он же используется для перестановки,
+    // keys — буфер пар, который вызывающий может держать между вызовами.
+    template <class T, class KeyOf>
+    void RadixSortBy(T* data, T* scratch, int count, KeyOf keyOf, RadixKeyBuffer& keys) {
+        using Key = std::decay_t<decltype(keyOf(*data))>;
+        using Bits = typename RadixTraits<Key>::Bits;
+        using Entry = RadixEntry<Bits>;
+        if (count < 2) return;
+
+        Entry* entries = keys.Reserve<Entry>(2 * count);
+        for (int i = 0; i < count; ++i)
+            entries[i] = Entry{RadixTraits<Key>::Encode(keyOf(data[i])), i};
+        LsdRadixSort(entries, entries + count, count, [](const Entry& entry) { return entry.key; });
+
+        for (int i = 0; i < count; ++i)
+            scratch[i] = std::move(data[entries[i].index]);
+        for (int i = 0; i < count; ++i)
+            data[i] = std::move(scratch[i]);
+    }
+
+    template <class T, class KeyOf>
+    void RadixSortBy(T* data, T* scratch, int count, KeyOf keyOf) {
+        RadixKeyBuffer keys;
+        RadixSortBy(data, scratch, count, keyOf, keys);
+    }
+}
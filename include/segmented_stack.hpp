@@ -0,0 +1,214 @@
+#pragma once
+
+#include <new>
+#include <utility>
+
+#include "stack.hpp"
+#include "errors.hpp"
+
+// Стек из связанных блоков фиксированного размера. Элементы создаются
+// размещающим new прямо в блоке и никогда не переносятся, поэтому Push и Pop —
+// O(1) в худшем случае, без перевыделения и копирования всего буфера.
+// Опустевший блок не удаляется, а остаётся запасным: чередование Push/Pop на
+// границе блоков не приводит к постоянным выделениям памяти.
+template <class T>
+class SegmentedStack : public Stack<T> {
+private:
+    static constexpr int BlockBytes = 4096;
+    static constexpr int BlockSize = sizeof(T) * 16 > BlockBytes ? 16 : static_cast<int>(BlockBytes / sizeof(T));
+
+    struct Block {
+        Block* prev = nullptr;
+        Block* next = nullptr;
+        alignas(T) unsigned char storage[BlockSize * sizeof(T)];
+
+        T* Slot(int index) { return reinterpret_cast<T*>(storage) + index; }
+        const T* Slot(int index) const { return reinterpret_cast<const T*>(storage) + index; }
+    };
+
+    Block* bottom;
+    Block* top;
+    Block* spare;
+    int topCount; // элементов в верхнем блоке
+    int length;
+
+    Block* NewBlock();
+    void ReleaseTop();
+    const T* Locate(int index) const;
+
+public:
+    SegmentedStack();
+    SegmentedStack(T* items, int count);
+    SegmentedStack(const SegmentedStack<T>& other);
+    SegmentedStack<T>& operator=(SegmentedStack<T> other);
+    ~SegmentedStack() override;
+
+    void Push(const T& item) override;
+    T Pop() override;
+    T Top() const override;
+    T& Top();
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+
+    int GetLength() const override;
+    bool IsEmpty() const override;
+
+    void Clear() override;
+
+    // func(item) от дна к вершине
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+template <class T>
+SegmentedStack<T>::SegmentedStack() : bottom(nullptr), top(nullptr), spare(nullptr), topCount(0), length(0) {}
+
+template <class T>
+SegmentedStack<T>::SegmentedStack(T* items, int count) : SegmentedStack() {
+    if (count < 0) throw Errors::NegativeCount();
+    for (int i = 0; i < count; ++i) Push(items[i]);
+}
+
+template <class T>
+SegmentedStack<T>::SegmentedStack(const SegmentedStack<T>& other) : SegmentedStack() {
+    other.ForEach([this](const T& item) { Push(item); });
+}
+
+template <class T>
+SegmentedStack<T>& SegmentedStack<T>::operator=(SegmentedStack<T> other) {
+    std::swap(bottom, other.bottom);
+    std::swap(top, other.top);
+    std::swap(spare, other.spare);
+    std::swap(topCount, other.topCount);
+    std::swap(length, other.length);
+    return *this;
+}
+
+template <class T>
+SegmentedStack<T>::~SegmentedStack() {
+    Clear();
+    delete spare;
+}
+
+// Запасной блок берётся раньше нового выделения
+template <class T>
+typename SegmentedStack<T>::Block* SegmentedStack<T>::NewBlock() {
+    Block* block = spare ? spare : new Block();
+    spare = nullptr;
+    block->prev = top;
+    block->next = nullptr;
+    return block;
+}
+
+// Пустой верхний блок становится запасным; прежний запасной освобождается
+template <class T>
+void SegmentedStack<T>::ReleaseTop() {
+    Block* released = top;
+    top = released->prev;
+    if (top) top->next = nullptr;
+    else bottom = nullptr;
+    topCount = top ? BlockSize : 0;
+    delete spare;
+    spare = released;
+}
+
+template <class T>
+const T* SegmentedStack<T>::Locate(int index) const {
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    const Block* block = bottom;
+    for (int skip = index / BlockSize; skip > 0; --skip) block = block->next;
+    return block->Slot(index % BlockSize);
+}
+
+// В новый блок элемент кладётся до того, как блок попадёт в стек: если копирование
+// бросит исключение, блок уходит в запасные, а стек остаётся прежним
+template <class T>
+void SegmentedStack<T>::Push(const T& item) {
+    if (top && topCount < BlockSize) {
+        new (top->Slot(topCount)) T(item);
+        ++topCount;
+    } else {
+        Block* block = NewBlock();
+        try {
+            new (block->Slot(0)) T(item);
+        } catch (...) {
+            spare = block;
+            throw;
+        }
+        if (top) top->next = block;
+        else bottom = block;
+        top = block;
+        topCount = 1;
+    }
+    ++length;
+}
+
+template <class T>
+T SegmentedStack<T>::Pop() {
+    if (length == 0) throw Errors::EmptyStackError();
+    T* slot = top->Slot(topCount - 1);
+    T item = std::move(*slot);
+    slot->~T();
+    --length;
+    if (--topCount == 0) ReleaseTop();
+    return item;
+}
+
+template <class T>
+T SegmentedStack<T>::Top() const {
+    if (length == 0) throw Errors::EmptyStackError();
+    return *top->Slot(topCount - 1);
+}
+
+template <class T>
+T& SegmentedStack<T>::Top() {
+    if (length == 0) throw Errors::EmptyStackError();
+    return *top->Slot(topCount - 1);
+}
+
+template <class T>
+T SegmentedStack<T>::GetFirst() const {
+    if (length == 0) throw Errors::EmptyStackError();
+    return *bottom->Slot(0);
+}
+
+template <class T>
+T SegmentedStack<T>::GetLast() const {
+    return Top();
+}
+
+// Индекс от дна, как у ArrayStack; проход по блокам — O(index / BlockSize)
+template <class T>
+T SegmentedStack<T>::Get(int index) const {
+    return *Locate(index);
+}
+
+template <class T>
+int SegmentedStack<T>::GetLength() const {
+    return length;
+}
+
+template <class T>
+bool SegmentedStack<T>::IsEmpty() const {
+    return length == 0;
+}
+
+template <class T>
+void SegmentedStack<T>::Clear() {
+    while (top) {
+        for (int i = topCount - 1; i >= 0; --i) top->Slot(i)->~T();
+        length -= topCount;
+        ReleaseTop();
+    }
+}
+
+template <class T>
+template <class F>
+void SegmentedStack<T>::ForEach(F&& func) const {
+    for (const Block* block = bottom; block; block = block->next) {
+        int count = block == top ? topCount : BlockSize;
+        for (int i = 0; i < count; ++i) func(*block->Slot(i));
+    }
+}
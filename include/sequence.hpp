@@ -1,18 +1,33 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <utility>
 #include <stdexcept>
+#include <type_traits>
 #include "errors.hpp"
+#include "dynamic_array.hpp"
+
+template <class T> class SequenceSource;
+template <class T, class Producer> class Pipeline;
 
 template <class T>
 class Sequence {
 public:
+    // Обработчик непрерывного куска элементов; false — прекратить обход
+    using ChunkVisitor = bool (*)(void* context, const T* chunk, int length);
+
     virtual ~Sequence() = default;
 
     virtual T GetFirst() const = 0;
     virtual T GetLast() const = 0;
     virtual T Get(int index) const = 0;
     virtual int GetLength() const = 0;
+    // Копирует count элементов, начиная со start, в out одним проходом
+    virtual void CopyTo(T* out, int start, int count) const = 0;
+    // Внутренняя итерация: бэкенд сам обходит элементы и отдаёт их кусками
+    virtual void VisitChunks(ChunkVisitor visit, void* context) const = 0;
     virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const = 0;
 
     virtual Sequence<T>* Remove(int index) = 0;
@@ -24,8 +39,49 @@ public:
     
     virtual Sequence<T>* Instance() = 0;
     virtual Sequence<T>* Clone() const = 0;
+
+    // func(const T* chunk, int length): один вызов на непрерывный кусок
+    template <class F>
+    void ForEachChunk(F&& func) const;
+    // func(const T& item): цикл по куску встраивается, косвенный вызов — только на кусок
+    template <class F>
+    void ForEach(F&& func) const;
+
+    // Ленивый конвейер Map/Where/Take/Reduce в один проход (см. pipeline.hpp)
+    Pipeline<T, SequenceSource<T>> Pipe() const;
 };
 
+template <class T>
+template <class F>
+void Sequence<T>::ForEachChunk(F&& func) const {
+    using Func = std::remove_reference_t<F>;
+    VisitChunks([](void* context, const T* chunk, int length) {
+        (*static_cast<Func*>(context))(chunk, length);
+        return true;
+    }, const_cast<void*>(static_cast<const void*>(std::addressof(func))));
+}
+
+template <class T>
+template <class F>
+void Sequence<T>::ForEach(F&& func) const {
+    ForEachChunk([&func](const T* chunk, int length) {
+        for (int i = 0; i < length; ++i)
+            func(chunk[i]);
+    });
+}
+
+// Предикат Where вида bool(T&) получает копию элемента, чтобы не менять исходную
+// последовательность; bool(const T&) — сам элемент
+template <class T, class P>
+bool Keeps(P& predicate, const T& item) {
+    if constexpr (std::is_invocable_v<P&, const T&>) {
+        return predicate(item);
+    } else {
+        T copy = item;
+        return predicate(copy);
+    }
+}
+
 template<typename T>
 Sequence<T>* operator+(const Sequence<T>& lhs, const Sequence<T>& rhs) {
     if (typeid(lhs) != typeid(rhs))
@@ -34,10 +90,69 @@ Sequence<T>* operator+(const Sequence<T>& lhs, const Sequence<T>& rhs) {
     return lhs.Concat(&rhs);
 }
 
+// Первый кусок VisitChunks покрывает всю последовательность — хранилище непрерывно
+template<typename T>
+bool IsContiguous(const Sequence<T>& seq) {
+    int first = 0;
+    seq.VisitChunks([](void* context, const T*, int length) {
+        *static_cast<int*>(context) = length;
+        return false;
+    }, &first);
+    return first == seq.GetLength();
+}
+
+// Сравнение за один линейный проход: одна сторона обходится через VisitChunks,
+// значения другой берутся у неё. Непрерывную сторону (массив) читаем окнами по
+// Window элементов через CopyTo — дёшево с любой позиции, память O(Window).
+// Если непрерывных сторон нет (два списка), другая сторона копируется один раз
+// целиком, иначе каждое окно проходило бы список заново с головы.
 template<typename T>
 bool operator==(const Sequence<T>& lhs, const Sequence<T>& rhs) {
-    if (lhs.GetLength() != rhs.GetLength()) return false;
-    for (int i = 0; i < lhs.GetLength(); ++i)
-        if (lhs.Get(i) != rhs.Get(i)) return false;
-    return true;
+    int length = lhs.GetLength();
+    if (length != rhs.GetLength()) return false;
+    if (length == 0) return true;
+
+    const Sequence<T>* visited = &lhs;
+    const Sequence<T>* fetched = &rhs;
+    bool windowed = IsContiguous(rhs);
+    if (!windowed && IsContiguous(lhs)) {
+        std::swap(visited, fetched);
+        windowed = true;
+    }
+
+    static constexpr int Window = 64;
+    struct Context {
+        const Sequence<T>* fetched;
+        DynamicArray<T> values; // fetched[start, end)
+        int length;
+        int start;
+        int end;
+        int position;
+        bool equal;
+
+        void Refill() {
+            int count = std::min(Window, length - position);
+            fetched->CopyTo(values.GetData(), position, count);
+            start = position;
+            end = position + count;
+        }
+    } context{fetched, DynamicArray<T>(windowed ? std::min(Window, length) : 0), length, 0, 0, 0, true};
+
+    if (!windowed) {
+        context.values.EnsureCapacity(length);
+        fetched->ForEachChunk([&context](const T* chunk, int count) { context.values.PushBackN(chunk, count); });
+        context.end = length;
+    }
+
+    visited->VisitChunks([](void* raw, const T* chunk, int count) {
+        Context& ctx = *static_cast<Context*>(raw);
+        for (int i = 0; i < count; ++i, ++ctx.position) {
+            if (ctx.position == ctx.end) ctx.Refill();
+            if (!(chunk[i] == ctx.values.GetData()[ctx.position - ctx.start])) return ctx.equal = false;
+        }
+        return true;
+    }, &context);
+    return context.equal;
 }
+
+#include "pipeline.hpp"
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+#include "dynamic_array.hpp"
+#include "static_sequence.hpp"
+#include "errors.hpp"
+
+// Стабильная ссылка на элемент SlotMap: номер слота и его поколение
+struct SlotHandle {
+    int index = -1;
+    int generation = 0;
+
+    bool operator==(const SlotHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+// Контейнер со стабильными дескрипторами поверх DynamicArray.
+// Значения лежат плотно (обход — по непрерывному массиву), слоты переводят
+// дескриптор в позицию значения. Удаление переносит последний элемент на место
+// удалённого и увеличивает поколение слота, поэтому старые дескрипторы
+// распознаются как устаревшие. Вставка и удаление — O(1) амортизированно.
+template <class T>
+class SlotMap {
+private:
+    struct Slot {
+        int generation = 0;
+        int target = 0; // живой слот: позиция в values; свободный — следующий свободный слот
+    };
+
+    DynamicArray<T>* values;
+    DynamicArray<int>* owners; // для каждой позиции в values — номер её слота
+    DynamicArray<Slot>* slots;
+    int freeHead;
+
+    int Resolve(const SlotHandle& handle) const;
+
+public:
+    SlotMap();
+    SlotMap(const SlotMap<T>& other);
+    SlotMap<T>& operator=(SlotMap<T> other);
+    ~SlotMap();
+
+    SlotHandle Insert(const T& item);
+    void Erase(const SlotHandle& handle);
+    bool Contains(const SlotHandle& handle) const;
+
+    T Get(const SlotHandle& handle) const;
+    T& GetRef(const SlotHandle& handle);
+    void Set(const SlotHandle& handle, const T& item);
+
+    int GetCount() const;
+    bool IsEmpty() const;
+    void Clear();
+
+    // Плотное хранилище: порядок меняется при удалении
+    const T* GetData() const;
+    ArraySequenceView<T> View() const;
+    SlotHandle HandleAt(int position) const;
+
+    template <class F>
+    void ForEach(F&& func) const;
+};
+
+template <class T>
+SlotMap<T>::SlotMap()
+    : values(new DynamicArray<T>(0)), owners(new DynamicArray<int>(0)), slots(new DynamicArray<Slot>(0)), freeHead(-1) {}
+
+template <class T>
+SlotMap<T>::SlotMap(const SlotMap<T>& other)
+    : values(new DynamicArray<T>(*other.values)), owners(new DynamicArray<int>(*other.owners)),
+      slots(new DynamicArray<Slot>(*other.slots)), freeHead(other.freeHead) {}
+
+template <class T>
+SlotMap<T>& SlotMap<T>::operator=(SlotMap<T> other) {
+    std::swap(values, other.values);
+    std::swap(owners, other.owners);
+    std::swap(slots, other.slots);
+    std::swap(freeHead, other.freeHead);
+    return *this;
+}
+
+template <class T>
+SlotMap<T>::~SlotMap() {
+    delete values;
+    delete owners;
+    delete slots;
+}
+
+// Позиция значения в values или -1 для устаревшего дескриптора
+template <class T>
+int SlotMap<T>::Resolve(const SlotHandle& handle) const {
+    if (handle.index < 0 || handle.index >= slots->GetSize()) return -1;
+    const Slot& slot = slots->GetData()[handle.index];
+    return slot.generation == handle.generation ? slot.target : -1;
+}
+
+template <class T>
+SlotHandle SlotMap<T>::Insert(const T& item) {
+    int slotIndex = freeHead;
+    if (slotIndex == -1) {
+        slotIndex = slots->GetSize();
+        slots->PushBack(Slot());
+    } else {
+        freeHead = slots->GetData()[slotIndex].target;
+    }
+
+    Slot& slot = slots->GetData()[slotIndex];
+    slot.target = values->GetSize();
+    values->PushBack(item);
+    owners->PushBack(slotIndex);
+    return SlotHandle{slotIndex, slot.generation};
+}
+
+template <class T>
+void SlotMap<T>::Erase(const SlotHandle& handle) {
+    int position = Resolve(handle);
+    if (position == -1) throw Errors::StaleHandle();
+
+    int last = values->GetSize() - 1;
+    T* data = values->GetData();
+    int* owner = owners->GetData();
+    if (position != last) {
+        data[position] = std::move(data[last]);
+        owner[position] = owner[last];
+        slots->GetData()[owner[position]].target = position;
+    }
+    values->PopBack();
+    owners->PopBack();
+
+    Slot& slot = slots->GetData()[handle.index];
+    ++slot.generation;
+    slot.target = freeHead;
+    freeHead = handle.index;
+}
+
+template <class T>
+bool SlotMap<T>::Contains(const SlotHandle& handle) const {
+    return Resolve(handle) != -1;
+}
+
+template <class T>
+T SlotMap<T>::Get(const SlotHandle& handle) const {
+    int position = Resolve(handle);
+    if (position == -1) throw Errors::StaleHandle();
+    return values->GetData()[position];
+}
+
+template <class T>
+T& SlotMap<T>::GetRef(const SlotHandle& handle) {
+    int position = Resolve(handle);
+    if (position == -1) throw Errors::StaleHandle();
+    return values->GetData()[position];
+}
+
+template <class T>
+void SlotMap<T>::Set(const SlotHandle& handle, const T& item) {
+    GetRef(handle) = item;
+}
+
+template <class T>
+int SlotMap<T>::GetCount() const {
+    return values->GetSize();
+}
+
+template <class T>
+bool SlotMap<T>::IsEmpty() const {
+    return values->GetSize() == 0;
+}
+
+// Все живые дескрипторы становятся устаревшими, слоты уходят в список свободных
+template <class T>
+void SlotMap<T>::Clear() {
+    const int* owner = owners->GetData();
+    Slot* slot = slots->GetData();
+    for (int i = 0; i < values->GetSize(); ++i) {
+        Slot& freed = slot[owner[i]];
+        ++freed.generation;
+        freed.target = freeHead;
+        freeHead = owner[i];
+    }
+    values->Clear();
+    owners->Clear();
+}
+
+template <class T>
+const T* SlotMap<T>::GetData() const {
+    return values->GetData();
+}
+
+template <class T>
+ArraySequenceView<T> SlotMap<T>::View() const {
+    return ArraySequenceView<T>(*values);
+}
+
+template <class T>
+SlotHandle SlotMap<T>::HandleAt(int position) const {
+    if (position < 0 || position >= values->GetSize()) throw Errors::IndexOutOfRange();
+    int slotIndex = owners->GetData()[position];
+    return SlotHandle{slotIndex, slots->GetData()[slotIndex].generation};
+}
+
+template <class T>
+template <class F>
+void SlotMap<T>::ForEach(F&& func) const {
+    const T* data = values->GetData();
+    for (int i = 0; i < values->GetSize(); ++i)
+        func(data[i]);
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+// Алгоритмы сортировки и поиска над непрерывным участком памяти.
+// Работают на месте, без промежуточных копий контейнера.
+namespace Sorting {
+
+    const int InsertionThreshold = 16;
+    const int MergeRun = 32;
+
+    // Устойчивая сортировка вставками для коротких участков
+    template <class T, class Compare>
+    void InsertionSort(T* data, int count, Compare& cmp) {
+        for (int i = 1; i < count; ++i) {
+            T value = std::move(data[i]);
+            int j = i;
+            for (; j > 0 && cmp(value, data[j - 1]); --j)
+                data[j] = std::move(data[j - 1]);
+            data[j] = std::move(value);
+        }
+    }
+
+    template <class T, class Compare>
+    void SiftDown(T* data, int root, int count, Compare& cmp) {
+        T value = std::move(data[root]);
+        while (true) {
+            int child = 2 * root + 1;
+            if (child >= count) break;
+            if (child + 1 < count && cmp(data[child], data[child + 1])) ++child;
+            if (!cmp(value, data[child])) break;
+            data[root] = std::move(data[child]);
+            root = child;
+        }
+        data[root] = std::move(value);
+    }
+
+    template <class T, class Compare>
+    void HeapSort(T* data, int count, Compare& cmp) {
+        for (int i = count / 2 - 1; i >= 0; --i)
+            SiftDown(data, i, count, cmp);
+        for (int end = count - 1; end > 0; --end) {
+            std::swap(data[0], data[end]);
+            SiftDown(data, 0, end, cmp);
+        }
+    }
+
+    // Медиана трёх ставится в середину и служит опорным элементом разбиения Хоара
+    template <class T, class Compare>
+    int Partition(T* data, int count, Compare& cmp) {
+        int mid = (count - 1) / 2;
+        if (cmp(data[mid], data[0])) std::swap(data[mid], data[0]);
+        if (cmp(data[count - 1], data[0])) std::swap(data[count - 1], data[0]);
+        if (cmp(data[count - 1], data[mid])) std::swap(data[count - 1], data[mid]);
+
+        T pivot = data[mid];
+        int i = -1;
+        int j = count;
+        while (true) {
+            do ++i; while (cmp(data[i], pivot));
+            do --j; while (cmp(pivot, data[j]));
+            if (i >= j) return j + 1;
+            std::swap(data[i], data[j]);
+        }
+    }
+
+    template <class T, class Compare>
+    void IntroSortLoop(T* data, int count, int depthLimit, Compare& cmp) {
+        while (count > InsertionThreshold) {
+            if (depthLimit == 0) {
+                HeapSort(data, count, cmp);
+                return;
+            }
+            --depthLimit;
+
+            int split = Partition(data, count, cmp);
+            // Рекурсия в меньшую часть, цикл по большей: глубина стека O(log n)
+            if (split < count - split) {
+                IntroSortLoop(data, split, depthLimit, cmp);
+                data += split;
+                count -= split;
+            } else {
+                IntroSortLoop(data + split, count - split, depthLimit, cmp);
+                count = split;
+            }
+        }
+        InsertionSort(data, count, cmp);
+    }
+
+    // Интроспективная сортировка: быстрая сортировка с переходом на пирамидальную
+    // при вырождении и сортировкой вставками на коротких участках
+    template <class T, class Compare>
+    void IntroSort(T* data, int count, Compare cmp) {
+        if (count < 2) return;
+        int depthLimit = 0;
+        for (int n = count; n > 1; n >>= 1) depthLimit += 2;
+        IntroSortLoop(data, count, depthLimit, cmp);
+    }
+
+    template <class T, class Compare>
+    void Merge(T* left, int leftCount, T* right, int rightCount, T* out, Compare& cmp) {
+        int i = 0, j = 0;
+        while (i < leftCount && j < rightCount) {
+            if (cmp(right[j], left[i])) *out++ = std::move(right[j++]);
+            else *out++ = std::move(left[i++]);
+        }
+        out = std::move(left + i, left + leftCount, out);
+        std::move(right + j, right + rightCount, out);
+    }
+
+    // Устойчивая восходящая сортировка слиянием с одним буфером размера count
+    template <class T, class Compare>
+    void MergeSort(T* data, int count, Compare cmp) {
+        if (count < 2) return;
+        for (int start = 0; start < count; start += MergeRun)
+            InsertionSort(data + start, std::min(MergeRun, count - start), cmp);
+        if (count <= MergeRun) return;
+
+        T* buffer = new T[count];
+        T* from = data;
+        T* to = buffer;
+        for (int width = MergeRun; width < count; width *= 2) {
+            for (int left = 0; left < count; left += 2 * width) {
+                int mid = std::min(left + width, count);
+                int right = std::min(left + 2 * width, count);
+                Merge(from + left, mid - left, from + mid, right - mid, to + left, cmp);
+            }
+            std::swap(from, to);
+        }
+        if (from != data)
+            std::move(from, from + count, data);
+        delete[] buffer;
+    }
+
+    template <class T, class Compare>
+    bool IsSorted(const T* data, int count, Compare cmp) {
+        for (int i = 1; i < count; ++i)
+            if (cmp(data[i], data[i - 1])) return false;
+        return true;
+    }
+
+    // Первая позиция, где элемент не меньше value
+    template <class T, class Compare>
+    int LowerBound(const T* data, int count, const T& value, Compare cmp) {
+        int low = 0, high = count;
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (cmp(data[mid], value)) low = mid + 1;
+            else high = mid;
+        }
+        return low;
+    }
+
+    // Первая позиция, где элемент больше value
+    template <class T, class Compare>
+    int UpperBound(const T* data, int count, const T& value, Compare cmp) {
+        int low = 0, high = count;
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (cmp(value, data[mid])) high = mid;
+            else low = mid + 1;
+        }
+        return low;
+    }
+}
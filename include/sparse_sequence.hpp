@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "sequence.hpp"
+#include "array_sequence.hpp"
+#include "dynamic_array.hpp"
+#include "sort.hpp"
+#include "errors.hpp"
+
+// Разреженная последовательность: хранятся только элементы, отличные от fill,
+// в двух параллельных массивах — отсортированных индексах и значениях.
+// Get — двоичный поиск по индексам, Map и Reduce проходят только по хранимым
+// элементам, обход кусками восстанавливает плотный вид по ChunkSize элементов.
+template <class T>
+class SparseSequence : public Sequence<T> {
+    template <class> friend class SparseSequence;
+
+private:
+    static constexpr int ChunkSize = 256;
+
+    DynamicArray<int>* indices;
+    DynamicArray<T>* values;
+    int length;
+    T fill;
+
+    int Stored() const { return indices->GetSize(); }
+    int Position(int index) const;
+    void Push(int index, const T& value);
+    void ShiftIndices(int from, int delta);
+
+public:
+    template <class F>
+    using MapResult = std::decay_t<std::invoke_result_t<F&, const T&>>;
+
+    explicit SparseSequence(int length = 0, const T& fill = T());
+    SparseSequence(const SparseSequence<T>& other);
+    SparseSequence<T>& operator=(SparseSequence<T> other);
+    ~SparseSequence() override;
+
+    // Из плотной последовательности сохраняются только элементы, отличные от fill
+    static SparseSequence<T> FromDense(const Sequence<T>& source, const T& fill = T());
+    MutableArraySequence<T> ToDense() const;
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+    int GetLength() const override;
+    void CopyTo(T* out, int start, int count) const override;
+    void VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const override;
+
+    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
+
+    void Set(int index, const T& value);
+    T GetFill() const;
+    int GetStoredCount() const;
+
+    // func(index, value) для каждого хранимого элемента по возрастанию индекса
+    template <class F>
+    void ForEachStored(F&& func) const;
+
+    // Значение по умолчанию тоже отображается: fill' = func(fill)
+    template <class F>
+    auto Map(F&& func) const -> SparseSequence<MapResult<F>>;
+    // Свёртка только по хранимым элементам (для fill, нейтрального к func, — по всем)
+    template <class A, class F>
+    A Reduce(F&& func, A init) const;
+};
+
+template <class T>
+SparseSequence<T>::SparseSequence(int length, const T& fill)
+    : indices(new DynamicArray<int>(0)), values(new DynamicArray<T>(0)), length(length), fill(fill) {
+    if (length < 0) throw Errors::NegativeSize();
+}
+
+template <class T>
+SparseSequence<T>::SparseSequence(const SparseSequence<T>& other)
+    : indices(new DynamicArray<int>(*other.indices)), values(new DynamicArray<T>(*other.values)),
+      length(other.length), fill(other.fill) {}
+
+template <class T>
+SparseSequence<T>& SparseSequence<T>::operator=(SparseSequence<T> other) {
+    std::swap(indices, other.indices);
+    std::swap(values, other.values);
+    std::swap(length, other.length);
+    std::swap(fill, other.fill);
+    return *this;
+}
+
+template <class T>
+SparseSequence<T>::~SparseSequence() {
+    delete indices;
+    delete values;
+}
+
+// Позиция первого хранимого элемента с индексом >= index
+template <class T>
+int SparseSequence<T>::Position(int index) const {
+    return Sorting::LowerBound(indices->GetData(), Stored(), index, std::less<int>());
+}
+
+template <class T>
+void SparseSequence<T>::Push(int index, const T& value) {
+    indices->PushBack(index);
+    values->PushBack(value);
+}
+
+template <class T>
+void SparseSequence<T>::ShiftIndices(int from, int delta) {
+    int* data = indices->GetData();
+    for (int i = Position(from); i < Stored(); ++i)
+        data[i] += delta;
+}
+
+template <class T>
+SparseSequence<T> SparseSequence<T>::FromDense(const Sequence<T>& source, const T& fill) {
+    SparseSequence<T> result(0, fill);
+    source.ForEach([&result](const T& item) { result.Append(item); });
+    return result;
+}
+
+template <class T>
+MutableArraySequence<T> SparseSequence<T>::ToDense() const {
+    DynamicArray<T> dense(length);
+    CopyTo(dense.GetData(), 0, length);
+    return MutableArraySequence<T>(dense);
+}
+
+template <class T>
+T SparseSequence<T>::GetFirst() const {
+    if (length == 0) throw Errors::EmptyArray();
+    return Get(0);
+}
+
+template <class T>
+T SparseSequence<T>::GetLast() const {
+    if (length == 0) throw Errors::EmptyArray();
+    return Get(length - 1);
+}
+
+template <class T>
+T SparseSequence<T>::Get(int index) const {
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    int position = Position(index);
+    if (position < Stored() && indices->GetData()[position] == index)
+        return values->GetData()[position];
+    return fill;
+}
+
+template <class T>
+int SparseSequence<T>::GetLength() const {
+    return length;
+}
+
+template <class T>
+void SparseSequence<T>::CopyTo(T* out, int start, int count) const {
+    if (count < 0) throw Errors::NegativeCount();
+    if (start < 0 || start + count > length) throw Errors::InvalidIndices();
+    std::fill(out, out + count, fill);
+    const int* index = indices->GetData();
+    const T* value = values->GetData();
+    for (int i = Position(start); i < Stored() && index[i] < start + count; ++i)
+        out[index[i] - start] = value[i];
+}
+
+template <class T>
+void SparseSequence<T>::VisitChunks(typename Sequence<T>::ChunkVisitor visit, void* context) const {
+    T buffer[ChunkSize];
+    for (int start = 0; start < length; start += ChunkSize) {
+        int n = std::min(ChunkSize, length - start);
+        CopyTo(buffer, start, n);
+        if (!visit(context, buffer, n)) return;
+    }
+}
+
+template <class T>
+Sequence<T>* SparseSequence<T>::GetSubsequence(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= length || startIndex > endIndex)
+        throw Errors::InvalidIndices();
+    auto* result = new SparseSequence<T>(endIndex - startIndex + 1, fill);
+    const int* index = indices->GetData();
+    const T* value = values->GetData();
+    for (int i = Position(startIndex); i < Stored() && index[i] <= endIndex; ++i)
+        result->Push(index[i] - startIndex, value[i]);
+    return result;
+}
+
+// Разреженная с тем же fill склеивается сдвигом индексов, остальные — поэлементно
+template <class T>
+Sequence<T>* SparseSequence<T>::Concat(const Sequence<T>* other) const {
+    if (!other) throw Errors::NullList();
+    auto* result = new SparseSequence<T>(*this);
+    auto otherSparse = dynamic_cast<const SparseSequence<T>*>(other);
+    if (otherSparse && otherSparse->fill == fill) {
+        otherSparse->ForEachStored([result, this](int index, const T& value) { result->Push(length + index, value); });
+        result->length += otherSparse->length;
+    } else {
+        other->ForEach([result](const T& item) { result->Append(item); });
+    }
+    return result;
+}
+
+template <class T>
+Sequence<T>* SparseSequence<T>::Append(T item) {
+    if (!(item == fill)) Push(length, item);
+    ++length;
+    return this;
+}
+
+template <class T>
+Sequence<T>* SparseSequence<T>::Prepend(T item) {
+    return InsertAt(item, 0);
+}
+
+template <class T>
+Sequence<T>* SparseSequence<T>::InsertAt(T item, int index) {
+    if (index < 0 || index > length) throw Errors::IndexOutOfRange();
+    ShiftIndices(index, 1);
+    ++length;
+    if (!(item == fill)) {
+        int position = Position(index);
+        indices->Insert(position, index);
+        values->Insert(position, item);
+    }
+    return this;
+}
+
+template <class T>
+Sequence<T>* SparseSequence<T>::Remove(int index) {
+    if (length == 0) throw Errors::EmptyArray();
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    int position = Position(index);
+    if (position < Stored() && indices->GetData()[position] == index) {
+        indices->Remove(position);
+        values->Remove(position);
+    }
+    ShiftIndices(index, -1);
+    --length;
+    return this;
+}
+
+template <class T>
+Sequence<T>* SparseSequence<T>::Instance() {
+    return this;
+}
+
+template <class T>
+Sequence<T>* SparseSequence<T>::Clone() const {
+    return new SparseSequence<T>(*this);
+}
+
+template <class T>
+void SparseSequence<T>::Set(int index, const T& value) {
+    if (index < 0 || index >= length) throw Errors::IndexOutOfRange();
+    int position = Position(index);
+    bool present = position < Stored() && indices->GetData()[position] == index;
+    if (value == fill) {
+        if (present) {
+            indices->Remove(position);
+            values->Remove(position);
+        }
+    } else if (present) {
+        values->GetData()[position] = value;
+    } else {
+        indices->Insert(position, index);
+        values->Insert(position, value);
+    }
+}
+
+template <class T>
+T SparseSequence<T>::GetFill() const {
+    return fill;
+}
+
+template <class T>
+int SparseSequence<T>::GetStoredCount() const {
+    return Stored();
+}
+
+template <class T>
+template <class F>
+void SparseSequence<T>::ForEachStored(F&& func) const {
+    const int* index = indices->GetData();
+    const T* value = values->GetData();
+    for (int i = 0; i < Stored(); ++i)
+        func(index[i], value[i]);
+}
+
+template <class T>
+template <class F>
+auto SparseSequence<T>::Map(F&& func) const -> SparseSequence<MapResult<F>> {
+    using U = MapResult<F>;
+    SparseSequence<U> result(length, func(fill));
+    ForEachStored([&](int index, const T& value) {
+        U mapped = func(value);
+        if (!(mapped == result.fill)) result.Push(index, mapped);
+    });
+    return result;
+}
+
+template <class T>
+template <class A, class F>
+A SparseSequence<T>::Reduce(F&& func, A init) const {
+    const T* value = values->GetData();
+    for (int i = 0; i < Stored(); ++i)
+        init = func(init, value[i]);
+    return init;
+}
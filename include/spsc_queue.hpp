@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "queue.hpp"
+#include "dynamic_array.hpp"
+#include "errors.hpp"
+
+// Ограниченная lock-free очередь для одного производителя и одного потребителя.
+// Индексы head и tail только растут, ячейка — index & mask. Каждый индекс пишет
+// ровно один поток (tail — производитель, head — потребитель) с release, а
+// читает другой с acquire. Индексы лежат в разных кэш-линиях, и каждая сторона
+// хранит последнее увиденное значение чужого индекса: атомарное чтение нужно,
+// только когда по кэшу очередь кажется полной или пустой.
+// Enqueue, TryEnqueue и EnqueueN вызывает только производитель; остальные
+// операции — только потребитель.
+template <class T>
+class SpscQueue : public Queue<T> {
+private:
+    static constexpr std::size_t CacheLine = 64;
+
+    alignas(CacheLine) std::atomic<std::size_t> tail;
+    std::size_t cachedHead; // head глазами производителя
+
+    // Where интерфейса Queue сдвигает голову из const-метода
+    alignas(CacheLine) mutable std::atomic<std::size_t> head;
+    mutable std::size_t cachedTail; // tail глазами потребителя
+
+    alignas(CacheLine) DynamicArray<T>* buffer;
+    std::size_t mask;
+
+    T& Slot(std::size_t index) const { return buffer->GetData()[index & mask]; }
+    std::size_t Capacity() const { return mask + 1; }
+    // Свободных ячеек для производителя / готовых элементов для потребителя;
+    // чужой индекс перечитывается, только если по кэшу их меньше wanted
+    std::size_t FreeSlots(std::size_t from, std::size_t wanted = 1);
+    std::size_t ReadySlots(std::size_t from, std::size_t wanted = 1) const;
+
+public:
+    explicit SpscQueue(int capacity = 1024);
+    SpscQueue(const SpscQueue<T>&) = delete;
+    SpscQueue<T>& operator=(const SpscQueue<T>&) = delete;
+    ~SpscQueue() override;
+
+    // Переполнение — исключение, как у FixedQueue
+    void Enqueue(const T& item) override;
+    T Dequeue() override;
+    T Peek() const override;
+
+    bool TryEnqueue(const T& item);
+    bool TryDequeue(T& out);
+
+    // Пакетные операции: одна публикация индекса на весь пакет; возвращают,
+    // сколько элементов удалось передать
+    int EnqueueN(const T* items, int count);
+    int DequeueN(T* out, int count);
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+
+    int GetLength() const override;
+    bool IsEmpty() const override;
+    int GetCapacity() const;
+
+    void Clear() override;
+
+    void Map(void (*func)(T&)) const override;
+    void Where(bool (*func)(T&)) const override;
+    T Reduce(T (*func)(const T&, const T&)) const override;
+};
+
+template <class T>
+SpscQueue<T>::SpscQueue(int capacity) : tail(0), cachedHead(0), head(0), cachedTail(0) {
+    if (capacity < 0) throw Errors::NegativeSize();
+    int rounded = 2;
+    while (rounded < capacity) rounded *= 2;
+    buffer = new DynamicArray<T>(rounded);
+    mask = static_cast<std::size_t>(rounded) - 1;
+}
+
+template <class T>
+SpscQueue<T>::~SpscQueue() {
+    delete buffer;
+}
+
+template <class T>
+std::size_t SpscQueue<T>::FreeSlots(std::size_t from, std::size_t wanted) {
+    std::size_t free = Capacity() - (from - cachedHead);
+    if (free < wanted) {
+        cachedHead = head.load(std::memory_order_acquire);
+        free = Capacity() - (from - cachedHead);
+    }
+    return free;
+}
+
+template <class T>
+std::size_t SpscQueue<T>::ReadySlots(std::size_t from, std::size_t wanted) const {
+    std::size_t ready = cachedTail - from;
+    if (ready < wanted) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        ready = cachedTail - from;
+    }
+    return ready;
+}
+
+template <class T>
+bool SpscQueue<T>::TryEnqueue(const T& item) {
+    std::size_t position = tail.load(std::memory_order_relaxed);
+    if (FreeSlots(position) == 0) return false;
+    Slot(position) = item;
+    tail.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+void SpscQueue<T>::Enqueue(const T& item) {
+    if (!TryEnqueue(item)) throw Errors::Full();
+}
+
+template <class T>
+int SpscQueue<T>::EnqueueN(const T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    std::size_t position = tail.load(std::memory_order_relaxed);
+    int n = static_cast<int>(std::min<std::size_t>(count, FreeSlots(position, count)));
+    for (int i = 0; i < n; ++i) Slot(position + i) = items[i];
+    tail.store(position + n, std::memory_order_release);
+    return n;
+}
+
+template <class T>
+bool SpscQueue<T>::TryDequeue(T& out) {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    if (ReadySlots(position) == 0) return false;
+    T& slot = Slot(position);
+    out = std::move(slot);
+    if constexpr (!std::is_trivially_destructible_v<T>) slot = T();
+    head.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+T SpscQueue<T>::Dequeue() {
+    T item;
+    if (!TryDequeue(item)) throw Errors::EmptyArray();
+    return item;
+}
+
+template <class T>
+int SpscQueue<T>::DequeueN(T* out, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    std::size_t position = head.load(std::memory_order_relaxed);
+    int n = static_cast<int>(std::min<std::size_t>(count, ReadySlots(position, count)));
+    for (int i = 0; i < n; ++i) {
+        T& slot = Slot(position + i);
+        out[i] = std::move(slot);
+        if constexpr (!std::is_trivially_destructible_v<T>) slot = T();
+    }
+    head.store(position + n, std::memory_order_release);
+    return n;
+}
+
+template <class T>
+T SpscQueue<T>::Peek() const {
+    return GetFirst();
+}
+
+template <class T>
+T SpscQueue<T>::GetFirst() const {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    if (ReadySlots(position) == 0) throw Errors::EmptyArray();
+    return Slot(position);
+}
+
+template <class T>
+T SpscQueue<T>::GetLast() const {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    std::size_t last = tail.load(std::memory_order_acquire);
+    if (last == position) throw Errors::EmptyArray();
+    return Slot(last - 1);
+}
+
+template <class T>
+T SpscQueue<T>::Get(int index) const {
+    if (index < 0) throw Errors::IndexOutOfRange();
+    std::size_t position = head.load(std::memory_order_relaxed);
+    if (static_cast<std::size_t>(index) >= ReadySlots(position, index + 1)) throw Errors::IndexOutOfRange();
+    return Slot(position + index);
+}
+
+// С любой стороны — снимок, который может тут же устареть
+template <class T>
+int SpscQueue<T>::GetLength() const {
+    std::size_t first = head.load(std::memory_order_acquire);
+    std::size_t last = tail.load(std::memory_order_acquire);
+    return last > first ? static_cast<int>(last - first) : 0;
+}
+
+template <class T>
+bool SpscQueue<T>::IsEmpty() const {
+    return GetLength() == 0;
+}
+
+template <class T>
+int SpscQueue<T>::GetCapacity() const {
+    return static_cast<int>(Capacity());
+}
+
+// Потребитель отбрасывает всё, что успело быть опубликовано
+template <class T>
+void SpscQueue<T>::Clear() {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    std::size_t last = tail.load(std::memory_order_acquire);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = position; i < last; ++i) Slot(i) = T();
+    }
+    cachedTail = last;
+    head.store(last, std::memory_order_release);
+}
+
+template <class T>
+void SpscQueue<T>::Map(void (*func)(T&)) const {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    std::size_t last = tail.load(std::memory_order_acquire);
+    for (std::size_t i = position; i < last; ++i) func(Slot(i));
+}
+
+// Оставшиеся элементы уплотняются к хвосту, а голова сдвигается вперёд:
+// потребитель меняет только свой индекс
+template <class T>
+void SpscQueue<T>::Where(bool (*func)(T&)) const {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    std::size_t last = tail.load(std::memory_order_acquire);
+    std::size_t kept = last;
+    for (std::size_t i = last; i > position; --i) {
+        T& item = Slot(i - 1);
+        if (!func(item)) continue;
+        --kept;
+        if (kept != i - 1) Slot(kept) = std::move(item);
+    }
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = position; i < kept; ++i) Slot(i) = T();
+    }
+    head.store(kept, std::memory_order_release);
+}
+
+template <class T>
+T SpscQueue<T>::Reduce(T (*func)(const T&, const T&)) const {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    std::size_t last = tail.load(std::memory_order_acquire);
+    if (last == position) throw Errors::EmptyArray();
+    T result = Slot(position);
+    for (std::size_t i = position + 1; i < last; ++i) result = func(result, Slot(i));
+    return result;
+}
@@ -35,6 +35,12 @@ public:
     void Push(const T& item) override;
     T Pop() override;
     T Top() const override;
+    // Ссылка на вершину без копирования
+    T& Top();
+
+    // Пакетные операции: одна проверка границ на пакет; PopN кладёт вершину в out[0]
+    void PushN(const T* source, int count);
+    void PopN(T* out, int count);
 
     T GetFirst() const override;
     T GetLast() const override;
@@ -43,6 +49,7 @@ public:
     int GetLength() const override;
     bool IsEmpty() const override;
 
+    // O(1) для тривиально разрушаемых T
     void Clear() override;
 };
 
@@ -59,45 +66,62 @@ ArrayStack<T>::ArrayStack(const ArrayStack<T>& other)
 template <typename T>
 ArrayStack<T>::~ArrayStack() = default;
 
-// Методы стека
+// Методы стека: напрямую с концом массива, без виртуальных Get/Remove
 template <typename T>
 void ArrayStack<T>::Push(const T& item) {
-    this->Append(item);
+    this->items->PushBack(item);
 }
 
 template <typename T>
 T ArrayStack<T>::Pop() {
-    if (this->IsEmpty()) throw Errors::EmptyStackError();
-    T item = this->GetLast();
-    this->Remove(this->GetLength() - 1);
-    return item;
+    if (this->items->GetSize() == 0) throw Errors::EmptyStackError();
+    return this->items->PopBack();
 }
 
 template <typename T>
 T ArrayStack<T>::Top() const {
-    if (this->IsEmpty()) throw Errors::EmptyStackError();
-    return this->GetLast();
+    if (this->items->GetSize() == 0) throw Errors::EmptyStackError();
+    return this->items->GetData()[this->items->GetSize() - 1];
 }
 
-// Методы последовательности
 template <typename T>
-T ArrayStack<T>::GetFirst() const { return MutableArraySequence<T>::GetFirst(); }
+T& ArrayStack<T>::Top() {
+    if (this->items->GetSize() == 0) throw Errors::EmptyStackError();
+    return this->items->Back();
+}
+
+template <typename T>
+void ArrayStack<T>::PushN(const T* source, int count) {
+    this->items->PushBackN(source, count);
+}
+
+template <typename T>
+void ArrayStack<T>::PopN(T* out, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    if (count > this->items->GetSize()) throw Errors::EmptyStackError();
+    this->items->PopBackN(out, count);
+}
 
+// Методы последовательности: сразу через статическое представление, без
+// второго виртуального перехода в MutableArraySequence
 template <typename T>
-T ArrayStack<T>::GetLast() const { return MutableArraySequence<T>::GetLast(); }
+T ArrayStack<T>::GetFirst() const { return this->View().GetFirst(); }
 
 template <typename T>
-T ArrayStack<T>::Get(int index) const { return MutableArraySequence<T>::Get(index); }
+T ArrayStack<T>::GetLast() const { return this->View().GetLast(); }
 
 template <typename T>
-int ArrayStack<T>::GetLength() const { return MutableArraySequence<T>::GetLength(); }
+T ArrayStack<T>::Get(int index) const { return this->View().Get(index); }
 
 template <typename T>
-bool ArrayStack<T>::IsEmpty() const { return this->GetLength() == 0; }
+int ArrayStack<T>::GetLength() const { return this->View().GetLength(); }
+
+template <typename T>
+bool ArrayStack<T>::IsEmpty() const { return this->View().IsEmpty(); }
 
 template <typename T>
 void ArrayStack<T>::Clear() {
-    while (!IsEmpty()) Pop();
+    this->items->Clear();
 }
 
 
@@ -159,19 +183,19 @@ T ListStack<T>::Top() const {
 
 // Методы последовательности
 template <typename T>
-T ListStack<T>::GetFirst() const { return MutableListSequence<T>::GetFirst(); }
+T ListStack<T>::GetFirst() const { return this->View().GetFirst(); }
 
 template <typename T>
-T ListStack<T>::GetLast() const { return MutableListSequence<T>::GetLast(); }
+T ListStack<T>::GetLast() const { return this->View().GetLast(); }
 
 template <typename T>
-T ListStack<T>::Get(int index) const { return MutableListSequence<T>::Get(index); }
+T ListStack<T>::Get(int index) const { return this->View().Get(index); }
 
 template <typename T>
-int ListStack<T>::GetLength() const { return MutableListSequence<T>::GetLength(); }
+int ListStack<T>::GetLength() const { return this->View().GetLength(); }
 
 template <typename T>
-bool ListStack<T>::IsEmpty() const { return this->GetLength() == 0; }
+bool ListStack<T>::IsEmpty() const { return this->View().IsEmpty(); }
 
 template <typename T>
 void ListStack<T>::Clear() {
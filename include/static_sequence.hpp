@@ -0,0 +1,142 @@
+#pragma once
+
+#include "dynamic_array.hpp"
+#include "linked_list.hpp"
+#include "errors.hpp"
+
+// Статический (CRTP) интерфейс последовательности, повторяющий Sequence<T>.
+// Вызовы разрешаются на этапе компиляции, поэтому обобщённые алгоритмы ниже
+// пишутся один раз и полностью встраиваются для каждого бэкенда.
+//
+// Derived обязан предоставить:
+//   int Length() const;
+//   const T& At(int index) const;       // без проверки границ
+//   begin() / end()                     // однопроходный обход
+//   static void ThrowEmpty();
+template <class Derived, class T>
+class StaticSequence {
+protected:
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+
+public:
+    T GetFirst() const;
+    T GetLast() const;
+    T Get(int index) const;
+    int GetLength() const;
+    bool IsEmpty() const;
+
+    int IndexOf(const T& item) const;
+    bool Contains(const T& item) const;
+
+    template <class A, class F>
+    A Fold(A init, F&& func) const;
+
+    template <class OtherDerived>
+    bool Equals(const StaticSequence<OtherDerived, T>& other) const;
+};
+
+template <class Derived, class T>
+T StaticSequence<Derived, T>::GetFirst() const {
+    if (IsEmpty()) Derived::ThrowEmpty();
+    return *Self().begin();
+}
+
+template <class Derived, class T>
+T StaticSequence<Derived, T>::GetLast() const {
+    if (IsEmpty()) Derived::ThrowEmpty();
+    return Self().At(GetLength() - 1);
+}
+
+template <class Derived, class T>
+T StaticSequence<Derived, T>::Get(int index) const {
+    if (index < 0 || index >= GetLength()) throw Errors::IndexOutOfRange();
+    return Self().At(index);
+}
+
+template <class Derived, class T>
+int StaticSequence<Derived, T>::GetLength() const {
+    return Self().Length();
+}
+
+template <class Derived, class T>
+bool StaticSequence<Derived, T>::IsEmpty() const {
+    return Self().Length() == 0;
+}
+
+template <class Derived, class T>
+int StaticSequence<Derived, T>::IndexOf(const T& item) const {
+    int index = 0;
+    for (const T& value : Self()) {
+        if (value == item) return index;
+        ++index;
+    }
+    return -1;
+}
+
+template <class Derived, class T>
+bool StaticSequence<Derived, T>::Contains(const T& item) const {
+    return IndexOf(item) != -1;
+}
+
+template <class Derived, class T>
+template <class A, class F>
+A StaticSequence<Derived, T>::Fold(A init, F&& func) const {
+    for (const T& value : Self())
+        init = func(init, value);
+    return init;
+}
+
+template <class Derived, class T>
+template <class OtherDerived>
+bool StaticSequence<Derived, T>::Equals(const StaticSequence<OtherDerived, T>& other) const {
+    if (GetLength() != other.GetLength()) return false;
+    auto it = static_cast<const OtherDerived&>(other).begin();
+    for (const T& value : Self()) {
+        if (!(value == *it)) return false;
+        ++it;
+    }
+    return true;
+}
+
+
+// Представление непрерывного массива
+template <class T>
+class ArraySequenceView : public StaticSequence<ArraySequenceView<T>, T> {
+private:
+    const T* data;
+    int length;
+
+public:
+    ArraySequenceView(const T* data, int length) : data(data), length(length) {}
+    explicit ArraySequenceView(const DynamicArray<T>& array) : data(array.GetData()), length(array.GetSize()) {}
+
+    int Length() const { return length; }
+    const T& At(int index) const { return data[index]; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + length; }
+
+    static void ThrowEmpty() { throw Errors::EmptyArray(); }
+};
+
+// Представление связного списка
+template <class T>
+class ListSequenceView : public StaticSequence<ListSequenceView<T>, T> {
+private:
+    const LinkedList<T>* list;
+
+public:
+    explicit ListSequenceView(const LinkedList<T>& list) : list(&list) {}
+
+    T GetLast() const { return list->GetLast(); } // без прохода через At
+
+    int Length() const { return list->GetLength(); }
+    const T& At(int index) const {
+        auto it = list->begin();
+        for (int i = 0; i < index; ++i) ++it;
+        return *it;
+    }
+    typename LinkedList<T>::ConstIterator begin() const { return list->begin(); }
+    typename LinkedList<T>::ConstIterator end() const { return list->end(); }
+
+    static void ThrowEmpty() { throw Errors::EmptyList(); }
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Многоключевая быстрая сортировка строк (Bentley–Sedgewick).
+// Разбиение идёт по префиксу на глубине depth, поэтому общие префиксы
+// не сравниваются повторно. Вместо одного символа в записи кэшируются сразу
+// 8 байт строки как целое число, так что за один проход снимается 8 символов
+// общего префикса. Сортируются компактные записи (указатель на текст, длина,
+// индекс, кэш), а сами элементы перемещаются один раз.
+// При равных ключах сохраняется исходный порядок.
+namespace Sorting {
+
+    struct StringEntry {
+        const char* text;
+        int length;
+        int index;
+        std::uint64_t cached; // 8 байт с позиции depth (старший байт — первый), хвост дополнен нулями
+    };
+
+    const int StringInsertionThreshold = 16;
+    const int StringChunk = 8;
+
+    inline std::uint64_t StringChunkAt(const StringEntry& entry, int depth) {
+        int available = std::min(StringChunk, entry.length - depth);
+        if (available <= 0) return 0;
+        if (available == StringChunk) {
+            unsigned char bytes[StringChunk];
+            std::memcpy(bytes, entry.text + depth, StringChunk);
+            return (std::uint64_t(bytes[0]) << 56) | (std::uint64_t(bytes[1]) << 48) |
+                   (std::uint64_t(bytes[2]) << 40) | (std::uint64_t(bytes[3]) << 32) |
+                   (std::uint64_t(bytes[4]) << 24) | (std::uint64_t(bytes[5]) << 16) |
+                   (std::uint64_t(bytes[6]) << 8) | std::uint64_t(bytes[7]);
+        }
+        std::uint64_t chunk = 0;
+        for (int i = 0; i < available; ++i)
+            chunk = (chunk << 8) | static_cast<unsigned char>(entry.text[depth + i]);
+        return chunk << (8 * (StringChunk - available));
+    }
+
+    // Сначала сравниваются закэшированные 8 байт, к тексту обращаемся только при их равенстве
+    inline bool StringEntryLess(const StringEntry& a, const StringEntry& b, int depth) {
+        if (a.cached != b.cached) return a.cached < b.cached;
+        int next = depth + StringChunk;
+        if (a.length <= next || b.length <= next)
+            return a.length < b.length || (a.length == b.length && a.index < b.index);
+        int compared = std::string_view(a.text + next, a.length - next)
+                           .compare(std::string_view(b.text + next, b.length - next));
+        return compared < 0 || (compared == 0 && a.index < b.index);
+    }
+
+    // Первые depth символов у всех записей уже совпадают, cached посчитан для depth
+    inline void StringInsertionSort(StringEntry* entries, int count, int depth) {
+        for (int i = 1; i < count; ++i) {
+            StringEntry value = entries[i];
+            int j = i;
+            for (; j > 0 && StringEntryLess(value, entries[j - 1], depth); --j)
+                entries[j] = entries[j - 1];
+            entries[j] = value;
+        }
+    }
+
+    inline std::uint64_t StringMedianOfThree(std::uint64_t a, std::uint64_t b, std::uint64_t c) {
+        if (a < b) return b < c ? b : (a < c ? c : a);
+        return a < c ? a : (b < c ? c : b);
+    }
+
+    // cached == true, если поле cached уже посчитано для этой глубины
+    inline void MultikeyQuickSort(StringEntry* entries, int count, int depth, bool cached) {
+        while (count > 1) {
+            if (!cached)
+                for (int i = 0; i < count; ++i)
+                    entries[i].cached = StringChunkAt(entries[i], depth);
+            if (count <= StringInsertionThreshold) {
+                StringInsertionSort(entries, count, depth);
+                return;
+            }
+            std::uint64_t pivot = StringMedianOfThree(entries[0].cached, entries[count / 2].cached, entries[count - 1].cached);
+
+            // Трёхчастное разбиение: [0, lt) < pivot, [lt, gt) == pivot, [gt, count) > pivot
+            int lt = 0, i = 0, gt = count;
+            while (i < gt) {
+                if (entries[i].cached < pivot) std::swap(entries[lt++], entries[i++]);
+                else if (entries[i].cached > pivot) std::swap(entries[i], entries[--gt]);
+                else ++i;
+            }
+
+            // Строки, закончившиеся внутри этих 8 байт, — префиксы остальных: короче значит меньше
+            StringEntry* equal = entries + lt;
+            StringEntry* equalEnd = entries + gt;
+            StringEntry* finished = std::partition(equal, equalEnd,
+                [depth](const StringEntry& entry) { return entry.length <= depth + StringChunk; });
+            std::sort(equal, finished, [](const StringEntry& a, const StringEntry& b) {
+                return a.length < b.length || (a.length == b.length && a.index < b.index);
+            });
+
+            // Рекурсия идёт в две меньшие части, самая большая остаётся циклу:
+            // каждая из меньших не длиннее половины, поэтому глубина стека O(log n)
+            struct Part {
+                StringEntry* entries;
+                int count;
+                int depth;
+                bool cached;
+            };
+            Part parts[3] = {
+                {entries, lt, depth, true},
+                {entries + gt, count - gt, depth, true},
+                {finished, static_cast<int>(equalEnd - finished), depth + StringChunk, false},
+            };
+            int largest = 0;
+            for (int part = 1; part < 3; ++part)
+                if (parts[part].count > parts[largest].count) largest = part;
+            for (int part = 0; part < 3; ++part)
+                if (part != largest)
+                    MultikeyQuickSort(parts[part].entries, parts[part].count, parts[part].depth, parts[part].cached);
+
+            entries = parts[largest].entries;
+            count = parts[largest].count;
+            depth = parts[largest].depth;
+            cached = parts[largest].cached;
+        }
+    }
+
+    // Сортировка записей по строковому ключу keyOf(item) (const std::string&).
+    // scratch — буфер на count элементов для итоговой перестановки.
+    template <class T, class KeyOf>
+    void StringSortBy(T* data, T* scratch, int count, KeyOf keyOf) {
+        if (count < 2) return;
+
+        StringEntry* entries = new StringEntry[count];
+        for (int i = 0; i < count; ++i) {
+            const std::string& key = keyOf(data[i]);
+            entries[i] = StringEntry{key.data(), static_cast<int>(key.size()), i, 0};
+        }
+        MultikeyQuickSort(entries, count, 0, false);
+
+        for (int i = 0; i < count; ++i)
+            scratch[i] = std::move(data[entries[i].index]);
+        for (int i = 0; i < count; ++i)
+            data[i] = std::move(scratch[i]);
+        delete[] entries;
+    }
+
+    inline void StringSort(std::string* data, std::string* scratch, int count) {
+        StringSortBy(data, scratch, count, [](const std::string& item) -> const std::string& { return item; });
+    }
+}
@@ -132,3 +132,16 @@ struct Teacher : public User {
     }
 };
 
+
+// Извлечение ключей для сортировки записей (RadixSortBy и т.п.)
+namespace UserKeys {
+    inline const std::string& Name(const User& user) { return user.name; }
+    inline const std::string& Group(const Student& student) { return student.group; }
+    inline const std::string& Subject(const Teacher& teacher) { return teacher.subject; }
+
+    inline int Id(const User& user) { return user.id; }
+    inline int Age(const User& user) { return user.age; }
+    // Средний балл с точностью до сотых: целый ключ вместо double
+    inline int GpaHundredths(const Student& student) { return static_cast<int>(student.gpa * 100 + 0.5); }
+    inline int Experience(const Teacher& teacher) { return teacher.experience; }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <functional>
+
+#include "hash_table.hpp"
+#include "sequence.hpp"
+#include "user.hpp"
+
+// Пользователи идентифицируются по id: хэш берётся только от него
+template <>
+struct Hasher<User> {
+    std::size_t operator()(const User& user) const { return std::hash<int>()(user.id); }
+};
+
+template <>
+struct Hasher<Student> : Hasher<User> {};
+
+template <>
+struct Hasher<Teacher> : Hasher<User> {};
+
+// Индекс записей по id за один проход по последовательности: поиск за O(1) в среднем.
+// При повторяющихся id остаётся последняя запись.
+template <class T>
+HashTable<int, T> IndexById(const Sequence<T>& records) {
+    HashTable<int, T> index(records.GetLength());
+    records.ForEach([&index](const T& record) { index.Set(record.id, record); });
+    return index;
+}
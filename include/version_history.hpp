@@ -0,0 +1,59 @@
+#pragma once
+
+#include "dynamic_array.hpp"
+#include "errors.hpp"
+
+// Линейная история версий персистентного состояния (PersistentList,
+// ImmutableQueue, ImmutableDeque). Версии делят структуру между собой,
+// поэтому запись и восстановление копируют только корень: O(1).
+template <class State>
+class VersionHistory {
+private:
+    DynamicArray<State> versions;
+    int current;
+
+public:
+    // Версия 0 — пустое состояние
+    VersionHistory();
+
+    const State& Current() const;
+    int GetCurrentVersion() const;
+    int GetCount() const;
+
+    // state становится текущим и записывается новой версией; возвращает её номер
+    int Commit(State state);
+    // Делает текущей сохранённую версию; сама история не меняется
+    const State& Restore(int version);
+};
+
+template <class State>
+VersionHistory<State>::VersionHistory() : versions(1), current(0) {}
+
+template <class State>
+const State& VersionHistory<State>::Current() const {
+    return versions[current];
+}
+
+template <class State>
+int VersionHistory<State>::GetCurrentVersion() const {
+    return current;
+}
+
+template <class State>
+int VersionHistory<State>::GetCount() const {
+    return versions.GetSize();
+}
+
+template <class State>
+int VersionHistory<State>::Commit(State state) {
+    versions.PushBack(state);
+    current = versions.GetSize() - 1;
+    return current;
+}
+
+template <class State>
+const State& VersionHistory<State>::Restore(int version) {
+    if (version < 0 || version >= versions.GetSize()) throw Errors::IndexOutOfRange();
+    current = version;
+    return versions[current];
+}
@@ -8,6 +8,10 @@
 #include "queue.hpp"
 #include "deque.hpp"
 #include "user.hpp"
+#include "persistent_list.hpp"
+#include "immutable_queue.hpp"
+#include "immutable_deque.hpp"
+#include "version_history.hpp"
 #include "errors.hpp"
 
 // ------------------------------------------------------------
@@ -56,6 +60,10 @@ public:
     virtual void ShowElements() const = 0;
     virtual void Menu() = 0;             
     virtual std::string Info() const = 0; 
+
+    // История версий: снимок и восстановление стоят O(1), т.к. версии — персистентные структуры
+    virtual int Snapshot() = 0;
+    virtual void Restore(int version) = 0;
 };
 
 // ---------------------------------------------------
@@ -85,50 +93,83 @@ class StackWrapper : public IWrapper {
     Container c_;
     std::string typeKey_;
     Stack<T>* st_;
+    const Sequence<T>* seq_;                  // тот же объект как последовательность
+    // Текущая версия истории — источник истины, а st_ — её рабочая копия:
+    // Restore только помечает её устаревшей, и собирается она при первом обращении
+    VersionHistory<PersistentList<T>> history_; // вершина стека — голова списка
+    mutable bool stale_ = false;
 
     Stack<T>* makeStack() {
         if (c_ == Container::ARRAY) return new ArrayStack<T>();
         return new ListStack<T>();
     }
+
+    Stack<T>& Live() const {
+        if (stale_) {
+            st_->Clear();
+            history_.Current().Reverse().ForEach([this](const T& item) { st_->Push(item); });
+            stale_ = false;
+        }
+        return *st_;
+    }
 public:
-    StackWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), st_(makeStack()) {}
+    StackWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), st_(makeStack()), seq_(dynamic_cast<const Sequence<T>*>(st_)) {}
     ~StackWrapper() override { delete st_; }
 
     // IWrapper
     std::string Info() const override {
-        return "Stack<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(st_->GetLength()) + ")";
+        return "Stack<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(history_.Current().GetLength())
+             + ", versions=" + std::to_string(history_.GetCount()) + ")";
+    }
+
+    int Snapshot() override {
+        return history_.Commit(history_.Current());
+    }
+
+    void Restore(int version) override {
+        history_.Restore(version);
+        stale_ = true;
     }
 
     void ShowElements() const override {
+        Live();
         std::cout << "[ ";
-        for (int i = 0; i < st_->GetLength(); ++i) std::cout << st_->Get(i) << " ";
+        seq_->ForEach([](const T& item) { std::cout << item << " "; });
         std::cout << "]\n";
     }
 
     void Menu() override {
         while (true) {
             std::cout << "\n--- Stack menu ---\n";
-            std::cout << "1. Push\n2. Pop\n3. Top\n4. Clear\n5. Show elements\n6. Back\nChoose: ";
+            std::cout << "1. Push\n2. Pop\n3. Top\n4. Clear\n5. Show elements\n6. Restore version\n7. Back\nChoose: ";
             try {
                 int ch = GetInt();
                 switch (ch) {
                     case 1: {
                         T val = GetTyped<T>();
-                        st_->Push(val);
+                        Live().Push(val);
+                        history_.Commit(history_.Current().Prepend(val));
                         break;
                     }
                     case 2: {
-                        T val = st_->Pop();
+                        T val = Live().Pop();
+                        history_.Commit(history_.Current().Tail());
                         std::cout << "Popped: " << val << "\n";
                         break;
                     }
                     case 3: {
-                        std::cout << "Top: " << st_->Top() << "\n";
+                        std::cout << "Top: " << Live().Top() << "\n";
                         break;
                     }
-                    case 4: st_->Clear(); std::cout << "Cleared\n"; break;
+                    case 4: st_->Clear(); stale_ = false; history_.Commit(PersistentList<T>()); std::cout << "Cleared\n"; break;
                     case 5: ShowElements(); break;
-                    case 6: return; // back
+                    case 6: {
+                        std::cout << "Available versions: 0 to " << history_.GetCount() - 1 << "\n";
+                        Restore(GetInt("Version: "));
+                        std::cout << "Restored as version " << Snapshot() << "\n";
+                        break;
+                    }
+                    case 7: return; // back
                     default: std::cout << "Invalid\n";
                 }
             } catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
@@ -143,49 +184,82 @@ class QueueWrapper : public IWrapper {
     Container c_;
     std::string typeKey_;
     Queue<T>* q_;
+    const Sequence<T>* seq_;
+    // Текущая версия истории — источник истины, а q_ — её рабочая копия:
+    // Restore только помечает её устаревшей, и собирается она при первом обращении
+    VersionHistory<ImmutableQueue<T>> history_;
+    mutable bool stale_ = false;
 
     Queue<T>* makeQueue() {
         if (c_ == Container::ARRAY) return new ArrayQueue<T>();
         return new ListQueue<T>();
     }
+
+    Queue<T>& Live() const {
+        if (stale_) {
+            q_->Clear();
+            history_.Current().ForEach([this](const T& item) { q_->Enqueue(item); });
+            stale_ = false;
+        }
+        return *q_;
+    }
 public:
-    QueueWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), q_(makeQueue()) {}
+    QueueWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), q_(makeQueue()), seq_(dynamic_cast<const Sequence<T>*>(q_)) {}
     ~QueueWrapper() override { delete q_; }
 
     std::string Info() const override {
-        return "Queue<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(q_->GetLength()) + ")";
+        return "Queue<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(history_.Current().GetLength())
+             + ", versions=" + std::to_string(history_.GetCount()) + ")";
+    }
+
+    int Snapshot() override {
+        return history_.Commit(history_.Current());
+    }
+
+    void Restore(int version) override {
+        history_.Restore(version);
+        stale_ = true;
     }
 
     void ShowElements() const override {
+        Live();
         std::cout << "[ ";
-        for (int i = 0; i < q_->GetLength(); ++i) std::cout << q_->Get(i) << " ";
+        seq_->ForEach([](const T& item) { std::cout << item << " "; });
         std::cout << "]\n";
     }
 
     void Menu() override {
         while (true) {
             std::cout << "\n--- Queue menu ---\n";
-            std::cout << "1. Enqueue\n2. Dequeue\n3. Peek\n4. Clear\n5. Show elements\n6. Back\nChoose: ";
+            std::cout << "1. Enqueue\n2. Dequeue\n3. Peek\n4. Clear\n5. Show elements\n6. Restore version\n7. Back\nChoose: ";
             try {
                 int ch = GetInt();
                 switch (ch) {
                     case 1: { // Enqueue
                         T val = GetTyped<T>();
-                        q_->Enqueue(val);
+                        Live().Enqueue(val);
+                        history_.Commit(history_.Current().Enqueue(val));
                         break;
                     }
                     case 2: { // Dequeue
-                        T val = q_->Dequeue();
+                        T val = Live().Dequeue();
+                        history_.Commit(history_.Current().Dequeue());
                         std::cout << "Dequeued: " << val << "\n";
                         break;
                     }
                     case 3: { // Peek
-                        std::cout << "Front element: " << q_->Peek() << "\n";
+                        std::cout << "Front element: " << Live().Peek() << "\n";
                         break;
                     }
-                    case 4: q_->Clear(); std::cout << "Cleared\n"; break; 
+                    case 4: q_->Clear(); stale_ = false; history_.Commit(ImmutableQueue<T>()); std::cout << "Cleared\n"; break; 
                     case 5: ShowElements(); break;
-                    case 6: return;
+                    case 6: { // Restore
+                        std::cout << "Available versions: 0 to " << history_.GetCount() - 1 << "\n";
+                        Restore(GetInt("Version: "));
+                        std::cout << "Restored as version " << Snapshot() << "\n";
+                        break;
+                    }
+                    case 7: return;
                     default: std::cout << "Invalid\n"; break;
                 }
             } catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
@@ -200,41 +274,72 @@ class DequeWrapper : public IWrapper {
     Container c_;
     std::string typeKey_;
     Deque<T>* d_;
+    const Sequence<T>* seq_;
+    // Текущая версия истории — источник истины, а d_ — её рабочая копия:
+    // Restore только помечает её устаревшей, и собирается она при первом обращении
+    VersionHistory<ImmutableDeque<T>> history_;
+    mutable bool stale_ = false;
 
     Deque<T>* makeDeque() {
         if (c_ == Container::ARRAY) return new ArrayDeque<T>();
         return new ListDeque<T>();
     }
+
+    Deque<T>& Live() const {
+        if (stale_) {
+            d_->Clear();
+            history_.Current().ForEach([this](const T& item) { d_->PushBack(item); });
+            stale_ = false;
+        }
+        return *d_;
+    }
 public:
-    DequeWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), d_(makeDeque()) {}
+    DequeWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), d_(makeDeque()), seq_(dynamic_cast<const Sequence<T>*>(d_)) {}
     ~DequeWrapper() override { delete d_; }
 
     std::string Info() const override {
-        return "Deque<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(d_->GetLength()) + ")";
+        return "Deque<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(history_.Current().GetLength())
+             + ", versions=" + std::to_string(history_.GetCount()) + ")";
+    }
+
+    int Snapshot() override {
+        return history_.Commit(history_.Current());
+    }
+
+    void Restore(int version) override {
+        history_.Restore(version);
+        stale_ = true;
     }
 
     void ShowElements() const override {
+        Live();
         std::cout << "[ ";
-        for (int i = 0; i < d_->GetLength(); ++i) std::cout << d_->Get(i) << " ";
+        seq_->ForEach([](const T& item) { std::cout << item << " "; });
         std::cout << "]\n";
     }
 
     void Menu() override {
         while (true) {
             std::cout << "\n--- Deque menu ---\n";
-            std::cout << "1. PushFront\n2. PushBack\n3. PopFront\n4. PopBack\n5. Front\n6. Back\n7. Clear\n8. Show elements\n9. Back to main\nChoose: ";
+            std::cout << "1. PushFront\n2. PushBack\n3. PopFront\n4. PopBack\n5. Front\n6. Back\n7. Clear\n8. Show elements\n9. Restore version\n10. Back to main\nChoose: ";
             try {
                 int ch = GetInt();
                 switch (ch) {
-                    case 1: d_->PushFront(GetTyped<T>()); break; 
-                    case 2: d_->PushBack(GetTyped<T>()); break;
-                    case 3: std::cout << "PopFront: " << d_->PopFront() << "\n"; break;
-                    case 4: std::cout << "PopBack: " << d_->PopBack() << "\n"; break;
-                    case 5: std::cout << "Front: " << d_->Front() << "\n"; break;
-                    case 6: std::cout << "Back: " << d_->Back() << "\n"; break;
-                    case 7: d_->Clear(); std::cout << "Cleared\n"; break;
+                    case 1: { T val = GetTyped<T>(); Live().PushFront(val); history_.Commit(history_.Current().PushFront(val)); break; }
+                    case 2: { T val = GetTyped<T>(); Live().PushBack(val); history_.Commit(history_.Current().PushBack(val)); break; }
+                    case 3: { T val = Live().PopFront(); history_.Commit(history_.Current().PopFront()); std::cout << "PopFront: " << val << "\n"; break; }
+                    case 4: { T val = Live().PopBack(); history_.Commit(history_.Current().PopBack()); std::cout << "PopBack: " << val << "\n"; break; }
+                    case 5: std::cout << "Front: " << Live().Front() << "\n"; break;
+                    case 6: std::cout << "Back: " << Live().Back() << "\n"; break;
+                    case 7: d_->Clear(); stale_ = false; history_.Commit(ImmutableDeque<T>()); std::cout << "Cleared\n"; break;
                     case 8: ShowElements(); break;
-                    case 9: return;
+                    case 9: {
+                        std::cout << "Available versions: 0 to " << history_.GetCount() - 1 << "\n";
+                        Restore(GetInt("Version: "));
+                        std::cout << "Restored as version " << Snapshot() << "\n";
+                        break;
+                    }
+                    case 10: return;
                     default: std::cout << "Invalid\n";
                 }
             } catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
@@ -1,6 +1,13 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <thread>
+#include <vector>
+
 #include "dynamic_array.hpp"
 #include "linked_list.hpp"
 #include "array_sequence.hpp"
@@ -9,6 +16,25 @@
 #include "stack.hpp"
 #include "deque.hpp"
 #include "user.hpp"
+#include "persistent_list.hpp"
+#include "immutable_queue.hpp"
+#include "immutable_deque.hpp"
+#include "version_history.hpp"
+#include "static_sequence.hpp"
+#include "hash_table.hpp"
+#include "user_index.hpp"
+#include "btree_map.hpp"
+#include "bit_sequence.hpp"
+#include "sparse_sequence.hpp"
+#include "slot_map.hpp"
+#include "concurrent_stack.hpp"
+#include "elimination_stack.hpp"
+#include "segmented_stack.hpp"
+#include "fixed_containers.hpp"
+#include "aggregate_stack.hpp"
+#include "spsc_queue.hpp"
+#include "mpmc_queue.hpp"
+#include "concurrent_queue.hpp"
 
 /*
 Макрос	Что делает
@@ -48,6 +74,37 @@ TEST_CASE("DynamicArray: Basic Operations", "[DynamicArray]") {
     REQUIRE(arr.GetSize() == 1);
 }
 
+TEST_CASE("DynamicArray: Arguments aliasing own storage", "[DynamicArray]") {
+    // Каждая вставка — при полной ёмкости, чтобы рост освобождал старое хранилище
+    DynamicArray<std::string> words(0);
+    words.PushBack("alpha");
+    words.PushBack("beta");
+    words.PushBack("gamma");
+    words.PushBack("delta");
+    REQUIRE(words.GetSize() == words.GetCapacity());
+
+    words.PushBack(words[0]);
+    REQUIRE(words[4] == "alpha");
+
+    words.PushBackN(words.GetData() + 1, 3);
+    REQUIRE(words.GetSize() == 8);
+    REQUIRE(words[5] == "beta");
+    REQUIRE(words[7] == "delta");
+
+    words.Insert(1, words.Back());
+    words.Insert(9, words[0]);
+    REQUIRE(words.GetSize() == 10);
+    REQUIRE(words[1] == "delta");
+    REQUIRE(words[2] == "beta");
+    REQUIRE(words[9] == "alpha");
+    REQUIRE(words[8] == "delta");
+
+    // Без роста: источник правее позиции вставки сдвигается вместе с хвостом
+    words.Insert(0, words[3]);
+    REQUIRE(words[0] == "gamma");
+    REQUIRE(words[4] == "gamma");
+}
+
 TEST_CASE("LinkedList: Basic Operations", "[LinkedList]") {
     LinkedList<int> list;
     list.Append(1);
@@ -182,8 +239,15 @@ TEST_CASE("ArrayQueue: Basic Operations and Map/Reduce", "[ArrayQueue]") {
     REQUIRE(q.Get(0) == 4);
     REQUIRE(q.Get(1) == 6);
 
-    // Where: оставить только > 4
-    q.Where([](int& x) { return x > 4; });
+    // Where с лямбдой возвращает новую очередь, исходная не меняется
+    ArrayQueue<int> big = q.Where([](int& x) { return x > 4; });
+    REQUIRE(big.GetLength() == 1);
+    REQUIRE(big.Get(0) == 6);
+    REQUIRE(q.GetLength() == 2);
+
+    // Where интерфейса Queue фильтрует на месте
+    Queue<int>& view = q;
+    view.Where([](int& x) { return x > 4; });
     REQUIRE(q.GetLength() == 1);
     REQUIRE(q.Get(0) == 6);
 
@@ -192,6 +256,63 @@ TEST_CASE("ArrayQueue: Basic Operations and Map/Reduce", "[ArrayQueue]") {
     REQUIRE(sum == 6);
 }
 
+TEST_CASE("ArrayQueue: Ring buffer with wraparound", "[ArrayQueue]") {
+    ArrayQueue<int> q;
+    for (int i = 0; i < 6; ++i) q.Enqueue(i);
+    for (int i = 0; i < 4; ++i) REQUIRE(q.Dequeue() == i);
+    for (int i = 6; i < 12; ++i) q.Enqueue(i); // хвост заворачивает в начало буфера
+    REQUIRE(q.GetCapacity() == 8);
+    REQUIRE(q.GetLength() == 8);
+    REQUIRE(q.Get(0) == 4);
+    REQUIRE(q.Get(7) == 11);
+
+    int out[8];
+    q.CopyTo(out, 0, 8);
+    REQUIRE(out[3] == 7);
+    REQUIRE(out[7] == 11);
+    int chunks = 0, total = 0;
+    q.ForEachChunk([&](const int* chunk, int length) {
+        ++chunks;
+        for (int i = 0; i < length; ++i) total += chunk[i];
+    });
+    REQUIRE(chunks == 2);
+    REQUIRE(total == 4 + 5 + 6 + 7 + 8 + 9 + 10 + 11);
+
+    q.Enqueue(12); // рост сохраняет порядок
+    REQUIRE(q.GetCapacity() == 16);
+    REQUIRE(q.GetFirst() == 4);
+    REQUIRE(q.GetLast() == 12);
+
+    q.Prepend(3);
+    q.InsertAt(100, 2);
+    q.Remove(2);
+    REQUIRE(q.Get(0) == 3);
+    REQUIRE(q.Get(2) == 5);
+
+    ArrayQueue<int> copy = q.Where([](int& x) { return x % 2 == 0; });
+    REQUIRE(copy.GetLength() == 5);
+    REQUIRE(copy.Dequeue() == 4);
+    REQUIRE(q.GetLength() == 10);
+
+    Sequence<int>* sub = q.GetSubsequence(1, 3);
+    REQUIRE(sub->GetLength() == 3);
+    REQUIRE(sub->Get(2) == 6);
+    delete sub;
+    REQUIRE(q.GetSubQueue(8, 9).GetLast() == 12);
+
+    while (!q.IsEmpty()) q.Dequeue();
+    REQUIRE_THROWS_AS(q.Dequeue(), std::out_of_range);
+    q.Clear();
+    q.Enqueue(1);
+    REQUIRE(q.Peek() == 1);
+
+    ArrayQueue<std::string> words;
+    for (int i = 0; i < 20; ++i) words.Enqueue(std::string(i, 'x'));
+    for (int i = 0; i < 15; ++i) words.Dequeue();
+    words = ArrayQueue<std::string>(words);
+    REQUIRE(words.Peek().size() == 15);
+}
+
 TEST_CASE("ListQueue: Basic Operations and Map/Reduce", "[ListQueue]") {
     ListQueue<int> q;
     q.Enqueue(10);
@@ -206,7 +327,9 @@ TEST_CASE("ListQueue: Basic Operations and Map/Reduce", "[ListQueue]") {
     REQUIRE(q.Get(0) == 21);
     REQUIRE(q.Get(1) == 31);
 
-    q.Where([](int& x) { return x % 2 == 1; });  // оставить нечётные
+    REQUIRE(q.Where([](int& x) { return x % 2 == 1; }).GetLength() == 2);
+    REQUIRE(q.GetLength() == 2);
+    static_cast<Queue<int>&>(q).Where([](int& x) { return x % 2 == 1; });  // оставить нечётные
     REQUIRE(q.GetLength() == 2);
 
     auto result = q.Reduce([](const int& a, const int& b) { return a * b; });
@@ -296,4 +419,1472 @@ TEST_CASE("Student in Stack/Queue/Deque", "[Student][Integration]") {
         copy.age = 99;
         REQUIRE_FALSE(copy == s1);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("PersistentList: Versions share structure", "[Persistent]") {
+    PersistentList<int> v0;
+    PersistentList<int> v1 = v0.Prepend(1);
+    PersistentList<int> v2 = v1.Prepend(2);
+    PersistentList<int> v3 = v2.Tail().Prepend(5);
+
+    REQUIRE(v0.IsEmpty());
+    REQUIRE(v1.GetFirst() == 1);
+    REQUIRE(v2.GetFirst() == 2);
+    REQUIRE(v2.GetLength() == 2);
+    REQUIRE(v3.GetFirst() == 5);
+    REQUIRE(v3.Tail().GetFirst() == 1);
+    REQUIRE_THROWS_AS(v0.Tail(), std::out_of_range);
+
+    PersistentList<int> longList;
+    for (int i = 0; i < 200000; ++i) longList = longList.Prepend(i);
+    REQUIRE(longList.GetLength() == 200000);
+}
+
+TEST_CASE("ImmutableQueue/ImmutableDeque: Real-time persistent operations", "[Persistent]") {
+    SECTION("ImmutableQueue") {
+        ImmutableQueue<int> q;
+        std::vector<ImmutableQueue<int>> history;
+        for (int i = 0; i < 100; ++i) {
+            q = q.Enqueue(i);
+            if (i % 3 == 0) q = q.Dequeue();
+            history.push_back(q);
+        }
+        REQUIRE(q.GetLength() == 66);
+        REQUIRE(q.Peek() == 34);
+        REQUIRE(history[0].IsEmpty());
+        REQUIRE(history[4].Peek() == 2);
+        REQUIRE(history[4].GetLength() == 3);
+
+        std::vector<int> items;
+        history[10].ForEach([&](const int& x) { items.push_back(x); });
+        REQUIRE(items == std::vector<int>{4, 5, 6, 7, 8, 9, 10});
+        REQUIRE_THROWS_AS(ImmutableQueue<int>().Dequeue(), std::out_of_range);
+    }
+
+    SECTION("ImmutableDeque against std::deque") {
+        ImmutableDeque<int> d;
+        std::deque<int> expected;
+        unsigned seed = 12345;
+        for (int step = 0; step < 5000; ++step) {
+            seed = seed * 1103515245u + 12345u;
+            int op = (seed >> 16) % 4;
+            if (expected.empty() || op < 2) {
+                if (op % 2 == 0) { d = d.PushFront(step); expected.push_front(step); }
+                else { d = d.PushBack(step); expected.push_back(step); }
+            } else if (op == 2) {
+                d = d.PopFront(); expected.pop_front();
+            } else {
+                d = d.PopBack(); expected.pop_back();
+            }
+            REQUIRE(d.GetLength() == static_cast<int>(expected.size()));
+            if (!expected.empty()) {
+                REQUIRE(d.Front() == expected.front());
+                REQUIRE(d.Back() == expected.back());
+            }
+        }
+        std::vector<int> items;
+        d.ForEach([&](const int& x) { items.push_back(x); });
+        REQUIRE(items == std::vector<int>(expected.begin(), expected.end()));
+        REQUIRE_THROWS_AS(ImmutableDeque<int>().PopBack(), std::out_of_range);
+    }
+}
+
+TEST_CASE("VersionHistory: Restoring versions", "[Persistent]") {
+    VersionHistory<PersistentList<int>> stack;
+    REQUIRE(stack.GetCount() == 1);
+    REQUIRE(stack.Current().IsEmpty());
+    for (int i = 1; i <= 3; ++i) REQUIRE(stack.Commit(stack.Current().Prepend(i)) == i);
+
+    REQUIRE(stack.Restore(1).GetFirst() == 1);
+    REQUIRE(stack.GetCurrentVersion() == 1);
+    REQUIRE(stack.GetCount() == 4);
+
+    // Ветка от восстановленной версии не трогает остальные
+    REQUIRE(stack.Commit(stack.Current().Prepend(9)) == 4);
+    REQUIRE(stack.Current().GetFirst() == 9);
+    REQUIRE(stack.Current().Tail().GetFirst() == 1);
+    REQUIRE(stack.Restore(3).GetFirst() == 3);
+    REQUIRE(stack.Current().GetLength() == 3);
+    REQUIRE(stack.Restore(0).IsEmpty());
+    REQUIRE(stack.Commit(stack.Current()) == 5);
+
+    REQUIRE_THROWS_AS(stack.Restore(6), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.Restore(-1), std::out_of_range);
+    REQUIRE(stack.GetCurrentVersion() == 5);
+
+    VersionHistory<ImmutableQueue<int>> queue;
+    for (int i = 0; i < 1000; ++i) queue.Commit(queue.Current().Enqueue(i));
+    queue.Commit(queue.Current().Dequeue());
+    REQUIRE(queue.Restore(500).GetLength() == 500);
+    REQUIRE(queue.Current().Peek() == 0);
+    REQUIRE(queue.Restore(1001).Peek() == 1);
+    REQUIRE(queue.Current().GetLength() == 999);
+}
+
+TEST_CASE("StaticSequence: Generic algorithms over array and list views", "[StaticSequence]") {
+    int raw[] = {3, 1, 4, 1, 5};
+    MutableArraySequence<int> arr(raw, 5);
+    MutableListSequence<int> list(raw, 5);
+    ArrayStack<int> stack(raw, 5);
+
+    auto arrView = arr.View();
+    auto listView = list.View();
+
+    REQUIRE(arrView.GetLength() == 5);
+    REQUIRE(arrView.GetLast() == 5);
+    REQUIRE(listView.Get(2) == 4);
+    REQUIRE(arrView.Equals(listView));
+    REQUIRE(listView.Equals(stack.View()));
+    REQUIRE(arrView.IndexOf(1) == 1);
+    REQUIRE_FALSE(listView.Contains(9));
+    REQUIRE(listView.Fold(0, [](int acc, const int& x) { return acc + x; }) == 14);
+
+    list.Append(9);
+    REQUIRE_FALSE(arrView.Equals(list.View()));
+
+    MutableArraySequence<int> empty;
+    REQUIRE_THROWS_AS(empty.View().GetFirst(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.View().Get(10), std::out_of_range);
+}
+
+TEST_CASE("Sequence: CopyTo and bulk comparison", "[Sequence][CopyTo]") {
+    int raw[] = {1, 2, 3, 4, 5, 6};
+    MutableArraySequence<int> arr(raw, 6);
+    MutableListSequence<int> list(raw, 6);
+
+    int out[4] = {0, 0, 0, 0};
+    arr.CopyTo(out, 1, 3);
+    REQUIRE(out[0] == 2);
+    REQUIRE(out[2] == 4);
+    list.CopyTo(out, 2, 4);
+    REQUIRE(out[0] == 3);
+    REQUIRE(out[3] == 6);
+    REQUIRE_THROWS_AS(arr.CopyTo(out, 4, 3), std::out_of_range);
+    REQUIRE_THROWS_AS(list.CopyTo(out, 0, -1), std::invalid_argument);
+
+    const Sequence<int>& a = arr;
+    const Sequence<int>& l = list;
+    REQUIRE(a == l);
+    REQUIRE(arr == MutableArraySequence<int>(raw, 6));
+    list.Append(7);
+    REQUIRE_FALSE(a == l);
+
+    // Длиннее окна сравнения; расхождение в середине и в неполном последнем окне
+    int values[200], middle[200], tail[200];
+    for (int i = 0; i < 200; ++i) values[i] = middle[i] = tail[i] = i;
+    middle[150] = -1;
+    tail[199] = -1;
+    MutableArraySequence<int> longArr(values, 200);
+    MutableListSequence<int> longList(values, 200);
+    const Sequence<int>& la = longArr;
+    const Sequence<int>& ll = longList;
+    REQUIRE(la == ll);
+    REQUIRE(ll == la);
+    REQUIRE(ll == MutableListSequence<int>(values, 200));
+    REQUIRE_FALSE(la == MutableListSequence<int>(middle, 200));
+    REQUIRE_FALSE(MutableListSequence<int>(middle, 200) == la);
+    REQUIRE_FALSE(ll == MutableListSequence<int>(tail, 200));
+    // Два списка: одна сторона копируется один раз, проход линейный
+    REQUIRE_FALSE(MutableListSequence<int>(middle, 200) == ll);
+    REQUIRE(MutableListSequence<int>(middle, 200) == MutableListSequence<int>(middle, 200));
+    REQUIRE_FALSE(la == MutableArraySequence<int>(tail, 200));
+
+    ArrayQueue<int> q1(raw, 3);
+    ArrayQueue<int> q2(raw + 3, 2);
+    ArrayQueue<int> clutched = q1.Clutch(q2);
+    int expected[] = {1, 4, 2, 5, 3};
+    REQUIRE(clutched == ArrayQueue<int>(expected, 5));
+    REQUIRE(q1.Concat(q2).GetLast() == 5);
+
+    ListQueue<int> lq(raw, 2);
+    ListQueue<int> mixed = lq.Clutch(q2);
+    REQUIRE(mixed.GetLength() == 4);
+    REQUIRE(mixed.Get(1) == 4);
+    REQUIRE(lq.Concat(q2).Get(3) == 5);
+}
+
+TEST_CASE("Sequence: ForEach and ForEachChunk", "[Sequence][ForEach]") {
+    int raw[] = {1, 2, 3, 4, 5};
+    MutableArraySequence<int> arr(raw, 5);
+    MutableListSequence<int> list(raw, 5);
+    const Sequence<int>* sequences[] = {&arr, &list};
+
+    for (const Sequence<int>* seq : sequences) {
+        int sum = 0;
+        seq->ForEach([&sum](const int& x) { sum += x; });
+        REQUIRE(sum == 15);
+
+        int chunks = 0, total = 0;
+        seq->ForEachChunk([&](const int* chunk, int length) {
+            ++chunks;
+            for (int i = 0; i < length; ++i) total += chunk[i];
+        });
+        REQUIRE(total == 15);
+        REQUIRE(chunks == (seq == &arr ? 1 : 5));
+    }
+
+    MutableArraySequence<int> empty;
+    int calls = 0;
+    empty.ForEachChunk([&calls](const int*, int) { ++calls; });
+    REQUIRE(calls == 0);
+}
+
+TEST_CASE("LinkedList: Tail pointer and Concat ownership", "[LinkedList]") {
+    LinkedList<int> list;
+    list.Prepend(2);
+    REQUIRE(list.GetTail() == 2);
+    list.Prepend(1);
+    list.InsertAt(3, 2);
+    REQUIRE(list.GetTail() == 3);
+    list.Remove(2);
+    REQUIRE(list.GetTail() == 2);
+    list.Append(4);
+    REQUIRE(list.GetLast() == 4);
+    list.Remove(0);
+    list.Remove(0);
+    list.Remove(0);
+    REQUIRE(list.GetLength() == 0);
+    list.Append(7);
+    REQUIRE(list.GetTail() == 7);
+
+    // Результат Concat не делит узлы со вторым списком
+    int rawLeft[] = {1, 2};
+    int rawRight[] = {3, 4};
+    LinkedList<int> left(rawLeft, 2);
+    LinkedList<int>* right = new LinkedList<int>(rawRight, 2);
+    LinkedList<int>* joined = left.Concat(right);
+    delete right;
+    REQUIRE(joined->GetLength() == 4);
+    REQUIRE(joined->Get(2) == 3);
+    REQUIRE(joined->GetLast() == 4);
+    joined->Append(5);
+    REQUIRE(joined->GetTail() == 5);
+    delete joined;
+    REQUIRE(left.GetLength() == 2);
+    REQUIRE(left.GetTail() == 2);
+}
+
+TEST_CASE("Sequence: Templated Map/Where/Reduce", "[Sequence][MapReduce]") {
+    int raw[] = {1, 2, 3, 4, 5};
+    int offset = 10;
+
+    SECTION("Array backend") {
+        MutableArraySequence<int> arr(raw, 5);
+        MutableArraySequence<int> shifted = arr.Map([offset](const int& x) { return x + offset; });
+        REQUIRE(shifted.GetLength() == 5);
+        REQUIRE(shifted.Get(4) == 15);
+        REQUIRE(arr.Get(4) == 5);
+
+        MutableArraySequence<std::string> names = arr.Map([](const int& x) { return std::string(x, '*'); });
+        REQUIRE(names.Get(2) == "***");
+
+        MutableArraySequence<int> odd = arr.Where([](const int& x) { return x % 2 == 1; });
+        REQUIRE(odd.GetLength() == 3);
+        REQUIRE(odd.GetLast() == 5);
+
+        REQUIRE(arr.Reduce([](int a, int b) { return a * b; }) == 120);
+        REQUIRE(arr.Reduce([](double acc, int x) { return acc + x / 2.0; }, 0.0) == Approx(7.5));
+        REQUIRE_THROWS_AS(MutableArraySequence<int>().Reduce([](int a, int b) { return a + b; }), std::out_of_range);
+    }
+
+    SECTION("List backend") {
+        MutableListSequence<int> list(raw, 5);
+        MutableListSequence<double> halves = list.Map([](const int& x) { return x / 2.0; });
+        REQUIRE(halves.Get(0) == Approx(0.5));
+        REQUIRE(halves.GetLast() == Approx(2.5));
+
+        MutableListSequence<int> big = list.Where([offset](const int& x) { return x * offset > 25; });
+        REQUIRE(big.GetLength() == 3);
+        big.Append(6);
+        REQUIRE(big.GetLast() == 6);
+
+        REQUIRE(list.Reduce([](int a, int b) { return a + b; }) == 15);
+        REQUIRE(list.Reduce([](std::string acc, int x) { return acc + std::to_string(x); }, std::string()) == "12345");
+    }
+
+    SECTION("Stacks and queues") {
+        ArrayStack<int> st(raw, 5);
+        REQUIRE(st.Map([](const int& x) { return x * x; }).GetLast() == 25);
+
+        ArrayQueue<int> q(raw, 5);
+        REQUIRE(q.Reduce([offset](const int& a, const int& b) { return a + b + offset; }) == 55);
+        ListQueue<int> lq(raw, 5);
+        REQUIRE(lq.Reduce([](long acc, const int& x) { return acc + x; }, 0L) == 15);
+
+        // Захватывающие лямбды дают новые очереди
+        int k = 2;
+        ArrayQueue<int> twice = q.Map([k](const int& x) { return x * k; });
+        REQUIRE(twice.GetLength() == 5);
+        REQUIRE(twice.Dequeue() == 2);
+        REQUIRE(twice.GetLast() == 10);
+        ArrayQueue<std::string> stars = q.Map([k](const int& x) { return std::string(x + k, '*'); });
+        REQUIRE(stars.Peek() == "***");
+        ArrayQueue<int> small = q.Where([k](const int& x) { return x <= k; });
+        REQUIRE(small.GetLength() == 2);
+        REQUIRE(small.GetLast() == 2);
+        REQUIRE(q.GetLength() == 5);
+
+        MutableListSequence<int> scaled = lq.Map([k](const int& x) { return x * k; });
+        REQUIRE(scaled.GetLast() == 10);
+        MutableListSequence<int> large = lq.Where([k](const int& x) { return x > k; });
+        REQUIRE(large.GetLength() == 3);
+        REQUIRE(lq.GetLength() == 5);
+
+        // Лямбда с параметром T& тоже даёт новую очередь; на месте — только через Queue
+        lq.Map([](int& x) { x += 1; });
+        REQUIRE(lq.Where([](int& x) { return x % 2 == 0; }).GetLength() == 3);
+        REQUIRE(q.Where([](int& x) { return x > 3; }).GetLength() == 2);
+        REQUIRE(lq.GetLength() == 5);
+        REQUIRE(q.GetLength() == 5);
+        static_cast<Queue<int>&>(lq).Where([](int& x) { return x % 2 == 0; });
+        REQUIRE(lq.GetLength() == 3);
+        REQUIRE(lq.GetFirst() == 2);
+    }
+}
+
+TEST_CASE("Pipeline: Fused lazy transforms", "[Pipeline]") {
+    int raw[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    MutableArraySequence<int> arr(raw, 10);
+    MutableListSequence<int> list(raw, 10);
+    const Sequence<int>* sequences[] = {&arr, &list};
+
+    for (const Sequence<int>* seq : sequences) {
+        int limit = 3;
+        int sum = seq->Pipe()
+            .Map([](const int& x) { return x * x; })
+            .Where([](const int& x) { return x % 2 == 0; })
+            .Take(limit)
+            .Reduce([](int a, int b) { return a + b; });
+        REQUIRE(sum == 4 + 16 + 36);
+
+        REQUIRE(seq->Pipe().Where([](const int& x) { return x > 7; }).Count() == 3);
+        REQUIRE(seq->Pipe().Map([](const int& x) { return x / 2.0; }).Reduce([](double a, double b) { return a + b; }, 0.0) == Approx(27.5));
+        REQUIRE(seq->Pipe().Take(0).Count() == 0);
+        REQUIRE_THROWS_AS(seq->Pipe().Where([](const int& x) { return x > 100; }).Reduce([](int a, int b) { return a + b; }), std::runtime_error);
+    }
+
+    int visited = 0;
+    arr.Pipe().Map([&visited](const int& x) { ++visited; return x; }).Take(2).Count();
+    REQUIRE(visited == 2);
+
+    ArrayQueue<int> q(raw, 10);
+    MutableListSequence<std::string> collected;
+    q.Pipe().Where([](const int& x) { return x % 5 == 0; })
+        .Map([](const int& x) { return std::to_string(x); })
+        .CollectTo(collected);
+    REQUIRE(collected.GetLength() == 2);
+    REQUIRE(collected.Get(1) == "10");
+}
+
+TEST_CASE("MutableArraySequence: Sort and binary search", "[ArraySequence][Sort]") {
+    unsigned seed = 12345;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return static_cast<int>((seed >> 8) % 1000); };
+
+    for (int length : {0, 1, 15, 17, 100, 1000}) {
+        MutableArraySequence<int> random, sorted, reversed, equal;
+        for (int i = 0; i < length; ++i) {
+            random.Append(next());
+            sorted.Append(i);
+            reversed.Append(length - i);
+            equal.Append(7);
+        }
+        std::vector<int> expected(length);
+        random.CopyTo(expected.data(), 0, length);
+        std::sort(expected.begin(), expected.end());
+
+        random.Sort();
+        REQUIRE(random.IsSorted());
+        for (int i = 0; i < length; ++i)
+            REQUIRE(random.Get(i) == expected[i]);
+
+        sorted.Sort();
+        reversed.Sort();
+        equal.Sort();
+        REQUIRE(sorted.IsSorted());
+        REQUIRE(reversed.IsSorted());
+        REQUIRE(equal.IsSorted());
+    }
+
+    MutableArraySequence<int> desc;
+    for (int i = 0; i < 50; ++i) desc.Append(next());
+    desc.Sort(std::greater<int>());
+    REQUIRE(desc.IsSorted(std::greater<int>()));
+    REQUIRE(desc.GetFirst() >= desc.GetLast());
+
+    // Устойчивость: пары с равными ключами сохраняют исходный порядок
+    MutableArraySequence<std::pair<int, int>> records;
+    for (int i = 0; i < 500; ++i) records.Append({next() % 10, i});
+    auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+    records.StableSort(byKey);
+    for (int i = 1; i < records.GetLength(); ++i) {
+        REQUIRE(records.Get(i - 1).first <= records.Get(i).first);
+        if (records.Get(i - 1).first == records.Get(i).first)
+            REQUIRE(records.Get(i - 1).second < records.Get(i).second);
+    }
+
+    int raw[] = {1, 3, 3, 3, 5, 8};
+    MutableArraySequence<int> arr(raw, 6);
+    REQUIRE(arr.LowerBound(3) == 1);
+    REQUIRE(arr.UpperBound(3) == 4);
+    REQUIRE(arr.LowerBound(0) == 0);
+    REQUIRE(arr.UpperBound(9) == 6);
+    REQUIRE(arr.BinarySearch(5) == 4);
+    REQUIRE(arr.BinarySearch(4) == -1);
+
+    REQUIRE(arr.SortedInsert(4) == 4);
+    REQUIRE(arr.SortedInsert(0) == 0);
+    REQUIRE(arr.SortedInsert(9) == 8);
+    REQUIRE(arr.GetLength() == 9);
+    REQUIRE(arr.IsSorted());
+    REQUIRE(arr.Get(5) == 4);
+}
+
+TEST_CASE("MutableArraySequence: Radix sort", "[ArraySequence][RadixSort]") {
+    unsigned seed = 777;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return seed; };
+
+    MutableArraySequence<int> ints;
+    MutableArraySequence<long long> longs;
+    MutableArraySequence<double> doubles;
+    for (int i = 0; i < 2000; ++i) {
+        ints.Append(static_cast<int>(next()));
+        longs.Append(static_cast<long long>(next()) * (i % 2 ? -1 : 1) * 100000);
+        doubles.Append((static_cast<int>(next() % 20001) - 10000) / 7.0);
+    }
+    doubles.Append(-0.0);
+    doubles.Append(0.0);
+
+    ints.RadixSort();
+    longs.RadixSort();
+    doubles.RadixSort();
+    REQUIRE(ints.IsSorted());
+    REQUIRE(longs.IsSorted());
+    REQUIRE(doubles.IsSorted());
+
+    // Пропуск разрядов: ключи различаются только младшим байтом
+    int small[] = {5, 3, 200, 1, 0};
+    MutableArraySequence<int> smallSeq(small, 5);
+    smallSeq.RadixSort();
+    REQUIRE(smallSeq.GetFirst() == 0);
+    REQUIRE(smallSeq.GetLast() == 200);
+
+    // Буфер остаётся между вызовами и дорастает, когда последовательность длиннее
+    for (int i = 0; i < 100; ++i)
+        smallSeq.Append(static_cast<int>(next() % 1000) - 500);
+    smallSeq.RadixSort();
+    REQUIRE(smallSeq.GetLength() == 105);
+    REQUIRE(smallSeq.IsSorted());
+
+    Sorting::RadixKeyBuffer keys;
+    auto* wide = keys.Reserve<Sorting::RadixEntry<std::uint64_t>>(64);
+    REQUIRE(keys.Reserve<Sorting::RadixEntry<std::uint32_t>>(64) == reinterpret_cast<Sorting::RadixEntry<std::uint32_t>*>(wide));
+
+    MutableArraySequence<Student> students;
+    students.Append(Student("Ann", 19, 42, "A", 4.5));
+    students.Append(Student("Bob", 20, -1, "B", 3.25));
+    students.Append(Student("Cid", 21, 7, "A", 4.5));
+    students.Append(Student("Dan", 22, 7, "C", 2.0));
+
+    students.RadixSortBy(UserKeys::Id);
+    REQUIRE(students.Get(0).name == "Bob");
+    REQUIRE(students.Get(1).name == "Cid"); // устойчивость при равных id
+    REQUIRE(students.Get(2).name == "Dan");
+    REQUIRE(students.Get(3).name == "Ann");
+
+    students.RadixSortBy(UserKeys::GpaHundredths);
+    REQUIRE(students.Get(0).name == "Dan");
+    REQUIRE(students.Get(1).name == "Bob");
+    REQUIRE(students.Get(2).name == "Cid");
+    REQUIRE(students.Get(3).name == "Ann");
+
+    students.RadixSortBy([](const Student& s) { return -s.gpa; });
+    REQUIRE(students.GetFirst().gpa == 4.5);
+    REQUIRE(students.GetLast().name == "Dan");
+}
+
+TEST_CASE("MutableArraySequence: Multikey string sort", "[ArraySequence][StringSort]") {
+    unsigned seed = 99;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 8); };
+
+    MutableArraySequence<std::string> words;
+    const std::string prefixes[] = {"", "a", "ab", "abc", "common_prefix_", "z"};
+    for (int i = 0; i < 1500; ++i) {
+        std::string word = prefixes[next() % 6];
+        int extra = next() % 4;
+        for (int j = 0; j < extra; ++j) word += static_cast<char>('a' + next() % 3);
+        if (i % 100 == 0) word += "\xC3\xA9"; // байты > 127 идут после ASCII
+        words.Append(word);
+    }
+    std::vector<std::string> expected(words.GetLength());
+    words.CopyTo(expected.data(), 0, words.GetLength());
+    std::sort(expected.begin(), expected.end());
+
+    words.StringSort();
+    for (int i = 0; i < words.GetLength(); ++i)
+        REQUIRE(words.Get(i) == expected[i]);
+
+    MutableArraySequence<Student> students;
+    students.Append(Student("Ivanov", 19, 1, "B-21", 4.0));
+    students.Append(Student("Ivan", 20, 2, "A-11", 3.0));
+    students.Append(Student("Ivanova", 21, 3, "B-21", 5.0));
+    students.Append(Student("Ivan", 22, 4, "A-10", 4.5));
+
+    students.StringSortBy(UserKeys::Name);
+    REQUIRE(students.Get(0).id == 2); // равные имена сохраняют исходный порядок
+    REQUIRE(students.Get(1).id == 4);
+    REQUIRE(students.Get(2).name == "Ivanov");
+    REQUIRE(students.Get(3).name == "Ivanova");
+
+    students.StringSortBy(UserKeys::Group);
+    REQUIRE(students.Get(0).group == "A-10");
+    REQUIRE(students.Get(1).group == "A-11");
+    REQUIRE(students.Get(2).id == 1);
+    REQUIRE(students.Get(3).id == 3);
+
+    MutableArraySequence<Teacher> teachers;
+    teachers.Append(Teacher("Petrov", 50, 1, "Physics", 20));
+    teachers.Append(Teacher("Sidorov", 45, 2, "Math", 15));
+    teachers.StringSortBy(UserKeys::Subject);
+    REQUIRE(teachers.GetFirst().subject == "Math");
+}
+
+TEST_CASE("HashTable: Robin Hood open addressing", "[HashTable]") {
+    HashTable<int, int> table;
+    REQUIRE(table.IsEmpty());
+    REQUIRE_THROWS_AS(table.Get(1), std::out_of_range);
+
+    // Ключи-кратные степени двойки проверяют перемешивание хэша
+    for (int i = 0; i < 5000; ++i) table.Set(i * 1024, i);
+    REQUIRE(table.GetCount() == 5000);
+    REQUIRE(table.GetCount() * 8 <= table.GetCapacity() * 7);
+    for (int i = 0; i < 5000; ++i) REQUIRE(table.Get(i * 1024) == i);
+    REQUIRE_FALSE(table.Contains(1));
+
+    table.Set(0, -1);
+    REQUIRE(table.Get(0) == -1);
+    REQUIRE(table.GetCount() == 5000);
+
+    for (int i = 0; i < 5000; i += 2) REQUIRE(table.Remove(i * 1024));
+    REQUIRE_FALSE(table.Remove(0));
+    REQUIRE(table.GetCount() == 2500);
+    for (int i = 1; i < 5000; i += 2) REQUIRE(*table.Find(i * 1024) == i);
+    REQUIRE(table.Find(2 * 1024) == nullptr);
+
+    HashTable<int, int> copy(table);
+    copy.Set(7, 7);
+    REQUIRE_FALSE(table.Contains(7));
+    int sum = 0;
+    copy.ForEach([&sum](const int&, const int& value) { sum += value; });
+    REQUIRE(sum == 2500 * 2500 + 7);
+
+    table.Clear();
+    REQUIRE(table.IsEmpty());
+    REQUIRE_FALSE(table.Contains(1024));
+
+    HashTable<std::string, int> words;
+    words.Set("alpha", 1);
+    words.Set("beta", 2);
+    REQUIRE(words.Get("beta") == 2);
+
+    ListQueue<Student> queue;
+    for (int i = 0; i < 100; ++i)
+        queue.Enqueue(Student("S" + std::to_string(i), 20, 1000 + i, "G", 4.0));
+    HashTable<int, Student> byId = IndexById<Student>(queue);
+    REQUIRE(byId.GetCount() == 100);
+    REQUIRE(byId.Get(1042).name == "S42");
+    REQUIRE_FALSE(byId.Contains(42));
+
+    HashTable<User, int> visits;
+    visits.Set(User("Ann", 20, 5), 1);
+    REQUIRE(visits.Contains(User("Ann", 20, 5)));
+    REQUIRE(Hasher<Student>()(Student("X", 1, 5, "G", 1.0)) == Hasher<User>()(User("Y", 2, 5)));
+}
+
+TEST_CASE("BTreeMap: Ordered map with ranges and bulk loading", "[BTreeMap]") {
+    BTreeMap<int, int> tree;
+    std::map<int, int> expected;
+    REQUIRE(tree.IsEmpty());
+    REQUIRE_THROWS_AS(tree.Get(1), std::out_of_range);
+
+    unsigned seed = 2024;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return static_cast<int>((seed >> 8) % 20000); };
+    for (int step = 0; step < 60000; ++step) {
+        int key = next();
+        if (step % 3 == 2) {
+            REQUIRE(tree.Remove(key) == (expected.erase(key) == 1));
+        } else {
+            tree.Set(key, step);
+            expected[key] = step;
+        }
+    }
+    REQUIRE(tree.GetCount() == static_cast<int>(expected.size()));
+
+    auto it = expected.begin();
+    for (auto node = tree.begin(); node != tree.end(); ++node, ++it) {
+        REQUIRE(node.Key() == it->first);
+        REQUIRE(node.Value() == it->second);
+    }
+    REQUIRE(it == expected.end());
+
+    for (int from : {-5, 0, 777, 5000, 19990}) {
+        int to = from + 400;
+        auto range = tree.Range(from, to);
+        int count = 0;
+        for (auto e = expected.lower_bound(from); e != expected.lower_bound(to); ++e) ++count;
+        REQUIRE(range.GetLength() == count);
+        if (count > 0) REQUIRE(range.GetFirst() == expected.lower_bound(from)->second);
+    }
+    REQUIRE(tree.Range(10, 10).IsEmpty());
+
+    // Удаление всех ключей сворачивает дерево обратно в один лист
+    BTreeMap<int, int> copy(tree);
+    for (const auto& entry : expected) REQUIRE(tree.Remove(entry.first));
+    REQUIRE(tree.IsEmpty());
+    REQUIRE(tree.begin() == tree.end());
+    REQUIRE(copy.GetCount() == static_cast<int>(expected.size()));
+    REQUIRE(copy.Get(expected.begin()->first) == expected.begin()->second);
+
+    MutableArraySequence<Student> students;
+    for (int i = 0; i < 1000; ++i)
+        students.Append(Student("S" + std::to_string(i), 20, i * 2, "G", (i % 50) / 10.0));
+    auto byId = BTreeMap<int, Student>::FromSorted(students, UserKeys::Id);
+    REQUIRE(byId.GetCount() == 1000);
+    REQUIRE(byId.Get(500).name == "S250");
+    REQUIRE_FALSE(byId.Contains(501));
+    auto slice = byId.Range(100, 120);
+    REQUIRE(slice.GetLength() == 10);
+    REQUIRE(slice.GetLast().id == 118);
+    int idSum = slice.Fold(0, [](int acc, const Student& s) { return acc + s.id; });
+    REQUIRE(idSum == 1090);
+
+    byId.Set(501, Student("New", 20, 501, "G", 3.0));
+    REQUIRE(byId.Remove(0));
+    REQUIRE(byId.begin().Key() == 2);
+    REQUIRE(byId.Range(498, 504).GetLength() == 4);
+
+    students.Prepend(Student("Late", 20, 5000, "G", 1.0));
+    REQUIRE_THROWS_AS((BTreeMap<int, Student>::FromSorted(students, UserKeys::Id)), std::invalid_argument);
+}
+
+TEST_CASE("BitSequence: Packed flags with word-level operations", "[BitSequence]") {
+    unsigned seed = 31337;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 16) % 3 == 0; };
+
+    BitSequence bits;
+    std::vector<bool> expected;
+    for (int i = 0; i < 300; ++i) {
+        bool value = next();
+        bits.Append(value);
+        expected.push_back(value);
+    }
+    bits.InsertAt(true, 63);
+    expected.insert(expected.begin() + 63, true);
+    bits.Prepend(false);
+    expected.insert(expected.begin(), false);
+    bits.Remove(128);
+    expected.erase(expected.begin() + 128);
+    bits.Remove(0);
+    expected.erase(expected.begin());
+
+    REQUIRE(bits.GetLength() == static_cast<int>(expected.size()));
+    int ones = 0;
+    for (int i = 0; i < bits.GetLength(); ++i) {
+        REQUIRE(bits.Get(i) == expected[i]);
+        ones += expected[i];
+    }
+    REQUIRE(bits.Count() == ones);
+    REQUIRE(bits.Not().Count() == bits.GetLength() - ones);
+
+    int visited = 0;
+    bits.ForEach([&](const bool& value) { REQUIRE(value == expected[visited++]); });
+    REQUIRE(visited == bits.GetLength());
+
+    Sequence<bool>* sub = bits.GetSubsequence(70, 200);
+    REQUIRE(sub->GetLength() == 131);
+    for (int i = 0; i < 131; ++i) REQUIRE(sub->Get(i) == expected[70 + i]);
+    Sequence<bool>* joined = bits.Concat(sub);
+    REQUIRE(joined->GetLength() == bits.GetLength() + 131);
+    REQUIRE(joined->Get(bits.GetLength() + 5) == expected[75]);
+    delete sub;
+    delete joined;
+
+    BitSequence evens(130), threes(130);
+    for (int i = 0; i < 130; ++i) {
+        evens.Set(i, i % 2 == 0);
+        threes.Set(i, i % 3 == 0);
+    }
+    REQUIRE(evens.And(threes).Count() == 22);
+    REQUIRE(evens.Or(threes).Count() == 65 + 44 - 22);
+    REQUIRE(evens.Xor(threes).Count() == 65 + 44 - 2 * 22);
+    REQUIRE_THROWS_AS(evens.And(BitSequence(5)), std::invalid_argument);
+
+    REQUIRE(evens.And(threes).FindFirst(true, 1) == 6);
+    REQUIRE(BitSequence(200).FindFirst() == -1);
+    REQUIRE(BitSequence(200, true).FindFirst(false) == -1);
+    REQUIRE(BitSequence(200, true).FindFirst(true, 199) == 199);
+
+    REQUIRE(bits.Where([](bool b) { return b; }).GetLength() == ones);
+    REQUIRE(bits.Where([](bool b) { return !b; }).Count() == 0);
+
+    int raw[130];
+    for (int i = 0; i < 130; ++i) raw[i] = i;
+    MutableListSequence<int> numbers(raw, 130);
+    BitSequence mask = BitSequence::Mask(numbers, [](const int& x) { return x % 10 == 0; });
+    REQUIRE(mask.Count() == 13);
+    MutableArraySequence<int> selected = mask.And(threes).Select<int>(numbers);
+    REQUIRE(selected.GetLength() == 5);
+    REQUIRE(selected.Get(1) == 30);
+    REQUIRE(selected.GetLast() == 120);
+}
+
+TEST_CASE("SparseSequence: Only non-default entries are stored", "[SparseSequence]") {
+    SparseSequence<double> sparse(1000);
+    sparse.Set(3, 1.5);
+    sparse.Set(500, -2.0);
+    sparse.Set(999, 4.0);
+    sparse.Set(500, 0.0); // возврат к значению по умолчанию удаляет запись
+    sparse.Set(700, 3.0);
+    REQUIRE(sparse.GetLength() == 1000);
+    REQUIRE(sparse.GetStoredCount() == 3);
+    REQUIRE(sparse.Get(3) == 1.5);
+    REQUIRE(sparse.Get(4) == 0.0);
+    REQUIRE(sparse.GetLast() == 4.0);
+    REQUIRE_THROWS_AS(sparse.Get(1000), std::out_of_range);
+
+    REQUIRE(sparse.Reduce([](double acc, double x) { return acc + x; }, 0.0) == Approx(8.5));
+    int calls = 0;
+    SparseSequence<double> doubled = sparse.Map([&calls](const double& x) { ++calls; return x * 2; });
+    REQUIRE(calls == 4); // три хранимых элемента и fill
+    REQUIRE(doubled.Get(700) == 6.0);
+    REQUIRE(doubled.GetStoredCount() == 3);
+    SparseSequence<double> shifted = sparse.Map([](const double& x) { return x + 1; });
+    REQUIRE(shifted.GetFill() == 1.0);
+    REQUIRE(shifted.Get(10) == 1.0);
+    REQUIRE(shifted.Get(3) == 2.5);
+
+    sparse.InsertAt(7.0, 0);
+    sparse.Prepend(0.0);
+    REQUIRE(sparse.GetLength() == 1002);
+    REQUIRE(sparse.Get(1) == 7.0);
+    REQUIRE(sparse.Get(5) == 1.5);
+    sparse.Remove(1);
+    sparse.Remove(0);
+    REQUIRE(sparse.Get(3) == 1.5);
+    REQUIRE(sparse.Get(700) == 3.0);
+
+    MutableArraySequence<double> dense = sparse.ToDense();
+    REQUIRE(dense.GetLength() == 1000);
+    REQUIRE(dense.Get(999) == 4.0);
+    REQUIRE(dense.Reduce([](double a, double b) { return a + b; }) == Approx(8.5));
+    SparseSequence<double> back = SparseSequence<double>::FromDense(dense);
+    REQUIRE(back.GetStoredCount() == 3);
+    REQUIRE(back == sparse);
+
+    Sequence<double>* part = sparse.GetSubsequence(600, 799);
+    REQUIRE(part->GetLength() == 200);
+    REQUIRE(part->Get(100) == 3.0);
+    Sequence<double>* joined = sparse.Concat(part);
+    REQUIRE(joined->GetLength() == 1200);
+    REQUIRE(joined->Get(1100) == 3.0);
+    REQUIRE(dynamic_cast<SparseSequence<double>*>(joined)->GetStoredCount() == 4);
+    delete part;
+    delete joined;
+
+    double sum = sparse.Pipe().Where([](const double& x) { return x > 2; }).Reduce([](double a, double b) { return a + b; }, 0.0);
+    REQUIRE(sum == 7.0);
+}
+
+TEST_CASE("SlotMap: Stable generational handles", "[SlotMap]") {
+    SlotMap<std::string> map;
+    SlotHandle a = map.Insert("a");
+    SlotHandle b = map.Insert("b");
+    SlotHandle c = map.Insert("c");
+    REQUIRE(map.GetCount() == 3);
+    REQUIRE(map.Get(b) == "b");
+
+    // Удаление из середины переносит последний элемент, но дескрипторы остаются верными
+    map.Erase(a);
+    REQUIRE_FALSE(map.Contains(a));
+    REQUIRE_THROWS_AS(map.Get(a), std::invalid_argument);
+    REQUIRE_THROWS_AS(map.Erase(a), std::invalid_argument);
+    REQUIRE(map.Get(c) == "c");
+    REQUIRE(map.GetData()[0] == "c");
+    REQUIRE(map.HandleAt(0) == c);
+
+    // Слот переиспользуется с новым поколением
+    SlotHandle d = map.Insert("d");
+    REQUIRE(d.index == a.index);
+    REQUIRE(d != a);
+    REQUIRE_FALSE(map.Contains(a));
+    map.GetRef(d) += "!";
+    map.Set(b, "B");
+    REQUIRE(map.Get(d) == "d!");
+    REQUIRE(map.View().Contains("B"));
+
+    std::string joined;
+    map.ForEach([&joined](const std::string& s) { joined += s; });
+    REQUIRE(joined.size() == 4);
+
+    SlotMap<std::string> copy(map);
+    map.Clear();
+    REQUIRE(map.IsEmpty());
+    REQUIRE_FALSE(map.Contains(b));
+    REQUIRE(copy.Get(b) == "B");
+
+    SlotMap<int> numbers;
+    SlotHandle handles[1000];
+    for (int i = 0; i < 1000; ++i) handles[i] = numbers.Insert(i);
+    for (int i = 0; i < 1000; i += 3) numbers.Erase(handles[i]);
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3 == 0) REQUIRE_FALSE(numbers.Contains(handles[i]));
+        else REQUIRE(numbers.Get(handles[i]) == i);
+    }
+    REQUIRE(numbers.GetCount() == 666);
+
+    // Вставка копии собственного элемента при полной ёмкости хранилища
+    SlotMap<std::string> names;
+    SlotHandle first = names.Insert("first");
+    for (int i = 0; i < 3; ++i) names.Insert("filler");
+    SlotHandle duplicate = names.Insert(names.GetRef(first));
+    REQUIRE(names.Get(duplicate) == "first");
+    REQUIRE(names.Get(first) == "first");
+}
+
+TEST_CASE("ArrayStack: Contiguous fast paths", "[Stack][ArrayStack]") {
+    ArrayStack<int> st;
+    int batch[100];
+    for (int i = 0; i < 100; ++i) batch[i] = i;
+    st.PushN(batch, 100);
+    st.Push(100);
+    REQUIRE(st.GetLength() == 101);
+    REQUIRE(st.Top() == 100);
+
+    st.Top() = 42; // вершина меняется на месте
+    REQUIRE(st.Pop() == 42);
+
+    int out[3];
+    st.PopN(out, 3);
+    REQUIRE(out[0] == 99);
+    REQUIRE(out[2] == 97);
+    REQUIRE(st.GetLength() == 97);
+    REQUIRE_THROWS_AS(st.PopN(out, 98), std::runtime_error);
+    REQUIRE_THROWS_AS(st.PushN(batch, -1), std::invalid_argument);
+    REQUIRE(st.GetLength() == 97);
+
+    const Stack<int>& view = st;
+    REQUIRE(view.Top() == 96);
+
+    st.Clear();
+    REQUIRE(st.IsEmpty());
+    REQUIRE_THROWS_AS(st.Top(), std::runtime_error);
+    st.Push(7);
+    REQUIRE(st.Pop() == 7);
+
+    ArrayStack<std::string> words;
+    std::string raw[] = {"a", "b", "c"};
+    words.PushN(raw, 3);
+    words.Top() += "!";
+    std::string popped[2];
+    words.PopN(popped, 2);
+    REQUIRE(popped[0] == "c!");
+    REQUIRE(popped[1] == "b");
+    words.Clear();
+    REQUIRE(words.GetLength() == 0);
+}
+
+TEST_CASE("ConcurrentStack: Lock-free Treiber stack", "[Stack][ConcurrentStack]") {
+    SECTION("Stack interface in one thread") {
+        int items[] = {1, 2, 3};
+        ConcurrentStack<int> st(items, 3);
+        REQUIRE(st.GetLength() == 3);
+        REQUIRE(st.Top() == 3);
+        REQUIRE(st.GetFirst() == 1);
+        REQUIRE(st.GetLast() == 3);
+        REQUIRE(st.Get(1) == 2);
+        REQUIRE_THROWS_AS(st.Get(3), std::out_of_range);
+        REQUIRE(st.Pop() == 3);
+
+        int value = 0;
+        REQUIRE(st.TryPop(value));
+        REQUIRE(value == 2);
+        st.Clear();
+        REQUIRE(st.IsEmpty());
+        REQUIRE(st.GetLength() == 0);
+        REQUIRE_FALSE(st.TryPop(value));
+        REQUIRE_THROWS_AS(st.Pop(), std::runtime_error);
+        REQUIRE_THROWS_AS(st.Top(), std::runtime_error);
+
+        Stack<std::string>* words = new ConcurrentStack<std::string>();
+        words->Push("a");
+        words->Push("b");
+        REQUIRE(words->Pop() == "b");
+        delete words;
+    }
+
+    SECTION("Every pushed value is popped exactly once") {
+        const int threads = 4;
+        const int perThread = 20000;
+        ConcurrentStack<int> st;
+        std::vector<std::vector<int>> popped(threads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&st, &popped, t] {
+                for (int i = 0; i < perThread; ++i) {
+                    st.Push(t * perThread + i);
+                    int value;
+                    if (i % 2 == 1 && st.TryPop(value)) popped[t].push_back(value);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        std::vector<int> all;
+        for (auto& part : popped) all.insert(all.end(), part.begin(), part.end());
+        int value;
+        while (st.TryPop(value)) all.push_back(value);
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == static_cast<size_t>(threads * perThread));
+        bool exact = true;
+        for (int i = 0; i < threads * perThread; ++i)
+            exact = exact && all[i] == i;
+        REQUIRE(exact);
+        REQUIRE(st.GetLength() == 0);
+    }
+}
+
+TEST_CASE("EliminationStack: Push/Pop pairs cancel out through the side array", "[Stack][EliminationStack]") {
+    SECTION("Same behaviour as the other stacks in one thread") {
+        int items[] = {1, 2, 3};
+        EliminationStack<int> st(items, 3);
+        Stack<int>& view = st;
+        REQUIRE(view.GetLength() == 3);
+        REQUIRE(view.Top() == 3);
+        REQUIRE(view.Get(0) == 1);
+        REQUIRE(view.Pop() == 3);
+        REQUIRE(view.Pop() == 2);
+        REQUIRE(view.Pop() == 1);
+        REQUIRE(view.IsEmpty());
+        REQUIRE_THROWS_AS(view.Pop(), std::runtime_error);
+        int value;
+        REQUIRE_FALSE(st.TryPop(value));
+    }
+
+    SECTION("Symmetric load from several threads loses nothing") {
+        const int threads = 4;
+        const int perThread = 20000;
+        EliminationStack<int> st;
+        std::vector<std::vector<int>> popped(threads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&st, &popped, t] {
+                int value;
+                for (int i = 0; i < perThread; ++i) {
+                    st.Push(t * perThread + i);
+                    if (st.TryPop(value)) popped[t].push_back(value);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        std::vector<int> all;
+        for (auto& part : popped) all.insert(all.end(), part.begin(), part.end());
+        int value;
+        while (st.TryPop(value)) all.push_back(value);
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == static_cast<size_t>(threads * perThread));
+        bool exact = true;
+        for (int i = 0; i < threads * perThread; ++i)
+            exact = exact && all[i] == i;
+        REQUIRE(exact);
+        REQUIRE(st.GetLength() == 0);
+    }
+
+    SECTION("Separate pushers and poppers neither lose nor duplicate values") {
+        // Снятые узлы сразу освобождаются и их адреса переиспользуются новыми Push
+        const int pushers = 4;
+        const int poppers = 4;
+        const int perThread = 20000;
+        const int total = pushers * perThread;
+        EliminationStack<int> st;
+        std::atomic<int> remaining(total);
+        std::vector<std::vector<int>> popped(poppers);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < pushers; ++t) {
+            workers.emplace_back([&st, t] {
+                for (int i = 0; i < perThread; ++i) st.Push(t * perThread + i);
+            });
+        }
+        for (int t = 0; t < poppers; ++t) {
+            workers.emplace_back([&st, &popped, &remaining, t] {
+                int value;
+                while (remaining.load(std::memory_order_relaxed) > 0) {
+                    if (!st.TryPop(value)) continue;
+                    popped[t].push_back(value);
+                    remaining.fetch_sub(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        std::vector<int> all;
+        for (auto& part : popped) all.insert(all.end(), part.begin(), part.end());
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == static_cast<size_t>(total));
+        bool exact = true;
+        for (int i = 0; i < total; ++i)
+            exact = exact && all[i] == i;
+        REQUIRE(exact);
+        REQUIRE(st.IsEmpty());
+    }
+}
+
+TEST_CASE("SegmentedStack: Linked fixed-size blocks", "[Stack][SegmentedStack]") {
+    SegmentedStack<int> st;
+    const int n = 5000; // несколько блоков по 1024 элемента
+    for (int i = 0; i < n; ++i) st.Push(i);
+    REQUIRE(st.GetLength() == n);
+    REQUIRE(st.GetFirst() == 0);
+    REQUIRE(st.Top() == n - 1);
+    REQUIRE(st.Get(1024) == 1024);
+    REQUIRE(st.Get(n - 1) == n - 1);
+    REQUIRE_THROWS_AS(st.Get(n), std::out_of_range);
+
+    // Чередование на границе блоков
+    for (int i = 0; i < 10; ++i) {
+        st.Push(-1);
+        REQUIRE(st.Pop() == -1);
+        REQUIRE(st.Pop() == n - 1 - i);
+    }
+    REQUIRE(st.GetLength() == n - 10);
+
+    SegmentedStack<int> copy(st);
+    while (!st.IsEmpty()) st.Pop();
+    REQUIRE_THROWS_AS(st.Pop(), std::runtime_error);
+    REQUIRE_THROWS_AS(st.Top(), std::runtime_error);
+    REQUIRE(copy.GetLength() == n - 10);
+    long long sum = 0;
+    copy.ForEach([&sum](int item) { sum += item; });
+    REQUIRE(sum == static_cast<long long>(n - 10) * (n - 11) / 2);
+
+    SegmentedStack<std::string> words;
+    for (int i = 0; i < 300; ++i) words.Push(std::string(40, static_cast<char>('a' + i % 26)));
+    words.Top() += "!";
+    REQUIRE(words.Pop().back() == '!');
+    Stack<std::string>& view = words;
+    REQUIRE(view.GetLength() == 299);
+    REQUIRE(view.Get(27) == std::string(40, 'b'));
+    words.Clear();
+    REQUIRE(words.IsEmpty());
+    words.Push("again");
+    REQUIRE(words.GetFirst() == "again");
+}
+
+struct ThrowingRecord {
+    static inline int copiesLeft = -1; // -1 — копирование никогда не бросает
+    int id = 0;
+    char payload[252] = {};
+
+    ThrowingRecord() = default;
+    explicit ThrowingRecord(int id) : id(id) {}
+    ThrowingRecord(const ThrowingRecord& other) : id(other.id) {
+        if (copiesLeft == 0) throw std::runtime_error("copy failed");
+        if (copiesLeft > 0) --copiesLeft;
+    }
+    ThrowingRecord& operator=(const ThrowingRecord&) = default;
+};
+
+TEST_CASE("SegmentedStack: Throwing copy on a block boundary", "[Stack][SegmentedStack]") {
+    static_assert(sizeof(ThrowingRecord) == 256, "16 records fill one block");
+    SegmentedStack<ThrowingRecord> st;
+    for (int i = 0; i < 16; ++i) st.Push(ThrowingRecord(i));
+
+    ThrowingRecord::copiesLeft = 0;
+    REQUIRE_THROWS_AS(st.Push(ThrowingRecord(16)), std::runtime_error);
+    ThrowingRecord::copiesLeft = -1;
+
+    REQUIRE(st.GetLength() == 16);
+    REQUIRE(st.Pop().id == 15);
+    REQUIRE(st.Top().id == 14);
+    st.Push(ThrowingRecord(15));
+    st.Push(ThrowingRecord(16));
+    REQUIRE(st.GetLength() == 17);
+    REQUIRE(st.Get(16).id == 16);
+    REQUIRE(st.Pop().id == 16);
+    REQUIRE(st.Pop().id == 15);
+}
+
+constexpr int FixedRingSum() {
+    auto ring = FixedRing<int, 4>::Of(1, 2, 3);
+    ring.PopFront();
+    ring.PushBack(4);
+    ring.PushBack(5); // запись через границу массива
+    ring.PopFront();
+    ring.PushFront(0);
+    int sum = 0;
+    for (int i = 0; i < ring.GetLength(); ++i) sum += ring.At(i);
+    return sum * 10 + ring.Front();
+}
+static_assert(FixedRingSum() == 120, "FixedRing must work in constant expressions");
+static_assert(FixedRing<int, 3>::Of(7, 8).Back() == 8, "FixedRing::Of must be constexpr");
+
+// Стек и очередь поверх кольца: PopBack снимает с конца, PopFront — с начала,
+// At после записи через ссылку видит новое значение
+constexpr int FixedRingStackAndQueue() {
+    auto ring = FixedRing<int, 3>::Of(1, 2, 3);
+    int popped = ring.PopBack() * 100;
+    ring.At(0) = 5;
+    popped += ring.PopFront() * 10;
+    ring.PushBack(6);
+    ring.PushBack(7);
+    return popped + (ring.IsFull() ? 1 : 0) + ring.At(2);
+}
+static_assert(FixedRingStackAndQueue() == 358, "FixedRing push/pop/At must be constexpr");
+static_assert(FixedRing<int, 2>::Of(1, 2).IsFull(), "Of fills the ring up to its capacity");
+static_assert(FixedRing<int, 4>::Of().IsEmpty() && FixedRing<int, 4>::Capacity == 4, "Capacity is a compile-time constant");
+static_assert(FixedStack<int, 8>::Capacity == 8 && FixedQueue<int, 2>::Capacity == 2 && FixedDeque<int, 5>::Capacity == 5,
+              "Capacity of the fixed containers is known at compile time");
+// Лишние значения отклоняются при компиляции: FixedRing<int, 2>::Of(1, 2, 3)
+// не собирается из-за static_assert в Of, а переполнение через PushBack внутри
+// constexpr-вычисления доходит до throw и тоже даёт ошибку компиляции
+
+TEST_CASE("FixedStack/FixedQueue/FixedDeque: Inline storage", "[Fixed]") {
+    SECTION("FixedStack") {
+        FixedStack<int, 3> st;
+        Stack<int>& view = st;
+        view.Push(1);
+        view.Push(2);
+        view.Push(3);
+        REQUIRE(st.IsFull());
+        REQUIRE_THROWS_AS(view.Push(4), std::overflow_error);
+        REQUIRE(view.GetFirst() == 1);
+        REQUIRE(view.Get(1) == 2);
+        REQUIRE(view.Pop() == 3);
+        REQUIRE(view.Top() == 2);
+        view.Clear();
+        REQUIRE_THROWS_AS(view.Pop(), std::runtime_error);
+        int raw[] = {1, 2, 3, 4};
+        REQUIRE_THROWS_AS((FixedStack<int, 3>(raw, 4)), std::overflow_error);
+    }
+
+    SECTION("FixedQueue wraps around without shifting") {
+        FixedQueue<int, 4> q;
+        Queue<int>& view = q;
+        for (int round = 0; round < 10; ++round) {
+            view.Enqueue(round);
+            view.Enqueue(round + 100);
+            REQUIRE(view.Dequeue() == round);
+            REQUIRE(view.Dequeue() == round + 100);
+        }
+        REQUIRE(view.IsEmpty());
+        REQUIRE_THROWS_AS(view.Dequeue(), std::out_of_range);
+
+        int raw[] = {1, 2, 3, 4};
+        FixedQueue<int, 4> full(raw, 4);
+        full.Dequeue();
+        full.Enqueue(5); // индексы 1..4 с заворотом
+        full.Map([](int& x) { x *= 10; });
+        full.Where([](int& x) { return x != 30; });
+        REQUIRE(full.GetLength() == 3);
+        REQUIRE(full.Get(0) == 20);
+        REQUIRE(full.GetLast() == 50);
+        REQUIRE(full.Reduce([](const int& a, const int& b) { return a + b; }) == 110);
+    }
+
+    SECTION("FixedDeque") {
+        FixedDeque<std::string, 3> d;
+        Deque<std::string>& view = d;
+        view.PushBack("b");
+        view.PushFront("a");
+        view.PushBack("c");
+        REQUIRE_THROWS_AS(view.PushFront("z"), std::overflow_error);
+        REQUIRE(view.Get(0) == "a");
+        REQUIRE(view.Get(2) == "c");
+        REQUIRE(view.PopBack() == "c");
+        REQUIRE(view.PopFront() == "a");
+        REQUIRE(view.Front() == "b");
+        REQUIRE(view.Back() == "b");
+        REQUIRE_THROWS_AS(view.Get(1), std::out_of_range);
+    }
+}
+
+template <class T>
+struct Product {
+    static T Combine(const T& accumulated, const T& item) { return accumulated * item; }
+};
+
+TEST_CASE("AggregateStack: O(1) running aggregates", "[Stack][AggregateStack]") {
+    AggregateStack<int, AggregateOps::Min, AggregateOps::Max, AggregateOps::Sum> st;
+    REQUIRE_THROWS_AS(st.Min(), std::runtime_error);
+
+    int values[] = {5, 3, 8, 1, 9, 2};
+    int expectedMin[] = {5, 3, 3, 1, 1, 1};
+    int expectedMax[] = {5, 5, 8, 8, 9, 9};
+    int sum = 0;
+    for (int i = 0; i < 6; ++i) {
+        st.Push(values[i]);
+        sum += values[i];
+        REQUIRE(st.Min() == expectedMin[i]);
+        REQUIRE(st.Max() == expectedMax[i]);
+        REQUIRE(st.Sum() == sum);
+    }
+
+    // После Pop агрегаты возвращаются к предыдущему состоянию
+    for (int i = 5; i > 0; --i) {
+        REQUIRE(st.Pop() == values[i]);
+        sum -= values[i];
+        REQUIRE(st.Min() == expectedMin[i - 1]);
+        REQUIRE(st.Max() == expectedMax[i - 1]);
+        REQUIRE(st.Aggregate<AggregateOps::Sum>() == sum);
+    }
+
+    Stack<int>& view = st;
+    REQUIRE(view.GetLength() == 1);
+    REQUIRE(view.Top() == 5);
+    view.Clear();
+    REQUIRE(view.IsEmpty());
+
+    AggregateStack<long long, Product, AggregateOps::Max> products;
+    long long raw[] = {2, 3, 4};
+    AggregateStack<long long, Product, AggregateOps::Max> filled(raw, 3);
+    products = filled;
+    REQUIRE(products.Aggregate<Product>() == 24);
+    REQUIRE(products.Max() == 4);
+    REQUIRE(products.Get(1) == 3);
+
+    AggregateStack<std::string, AggregateOps::Min, AggregateOps::Sum> words;
+    words.Push("b");
+    words.Push("a");
+    words.Push("c");
+    REQUIRE(words.Min() == "a");
+    REQUIRE(words.Sum() == "bac");
+}
+
+TEST_CASE("SpscQueue: Single-producer/single-consumer ring", "[Queue][SpscQueue]") {
+    SECTION("Queue interface in one thread") {
+        SpscQueue<int> q(4);
+        Queue<int>& view = q;
+        REQUIRE(q.GetCapacity() == 4);
+        for (int i = 1; i <= 4; ++i) view.Enqueue(i);
+        REQUIRE_THROWS_AS(view.Enqueue(5), std::overflow_error);
+        REQUIRE_FALSE(q.TryEnqueue(5));
+        REQUIRE(view.Peek() == 1);
+        REQUIRE(view.GetLast() == 4);
+        REQUIRE(view.Get(2) == 3);
+        REQUIRE_THROWS_AS(view.Get(4), std::out_of_range);
+
+        view.Map([](int& x) { x *= 10; });
+        view.Where([](int& x) { return x != 20; });
+        REQUIRE(view.GetLength() == 3);
+        REQUIRE(view.Get(0) == 10);
+        REQUIRE(view.Reduce([](const int& a, const int& b) { return a + b; }) == 80);
+        REQUIRE(view.Dequeue() == 10);
+
+        int batch[] = {7, 8, 9};
+        REQUIRE(q.EnqueueN(batch, 3) == 2); // осталось две свободные ячейки
+        int out[8];
+        REQUIRE(q.DequeueN(out, 8) == 4);
+        REQUIRE(out[0] == 30);
+        REQUIRE(out[3] == 8);
+        REQUIRE(view.IsEmpty());
+        REQUIRE_THROWS_AS(view.Dequeue(), std::out_of_range);
+
+        SpscQueue<std::string> words(2);
+        words.Enqueue("a");
+        words.Enqueue("b");
+        words.Clear();
+        REQUIRE(words.IsEmpty());
+        words.Enqueue("c");
+        REQUIRE(words.Dequeue() == "c");
+    }
+
+    SECTION("Two threads keep FIFO order") {
+        const int n = 200000;
+        SpscQueue<int> q(256);
+        std::thread producer([&q] {
+            int batch[16];
+            for (int i = 0; i < n;) {
+                int count = std::min(16, n - i);
+                for (int j = 0; j < count; ++j) batch[j] = i + j;
+                int sent = 0;
+                while (sent < count) {
+                    int pushed = q.EnqueueN(batch + sent, count - sent);
+                    if (pushed == 0) std::this_thread::yield();
+                    sent += pushed;
+                }
+                i += count;
+            }
+        });
+
+        bool ordered = true;
+        int expected = 0;
+        while (expected < n) {
+            int value;
+            if (!q.TryDequeue(value)) {
+                std::this_thread::yield();
+                continue;
+            }
+            ordered = ordered && value == expected;
+            ++expected;
+        }
+        producer.join();
+        REQUIRE(ordered);
+        REQUIRE(q.IsEmpty());
+    }
+}
+
+TEST_CASE("MpmcQueue: Bounded queue with sequence-numbered slots", "[Queue][MpmcQueue]") {
+    SECTION("Queue interface in one thread") {
+        MpmcQueue<int> q(4);
+        Queue<int>& view = q;
+        for (int round = 0; round < 3; ++round) { // несколько оборотов кольца
+            for (int i = 1; i <= 4; ++i) REQUIRE(q.TryEnqueue(i));
+            REQUIRE_FALSE(q.TryEnqueue(5));
+            REQUIRE_THROWS_AS(view.Enqueue(5), std::overflow_error);
+            REQUIRE(view.Dequeue() == 1);
+            view.Enqueue(5);
+            REQUIRE(view.Peek() == 2);
+            REQUIRE(view.GetLast() == 5);
+            REQUIRE(view.Get(2) == 4);
+            view.Clear();
+            REQUIRE(view.IsEmpty());
+        }
+
+        int value;
+        REQUIRE_FALSE(q.TryDequeue(value));
+        REQUIRE_THROWS_AS(view.Dequeue(), std::out_of_range);
+
+        for (int i = 1; i <= 4; ++i) view.Enqueue(i);
+        view.Map([](int& x) { x *= 10; });
+        view.Where([](int& x) { return x != 20; });
+        REQUIRE(view.GetLength() == 3);
+        REQUIRE(view.Reduce([](const int& a, const int& b) { return a + b; }) == 80);
+        view.Enqueue(50); // освободившаяся после Where ячейка снова доступна
+        REQUIRE(view.Dequeue() == 10);
+        REQUIRE(view.Dequeue() == 30);
+        REQUIRE(view.Dequeue() == 40);
+        REQUIRE(view.Dequeue() == 50);
+    }
+
+    SECTION("Producers and consumers deliver every value once") {
+        const int producers = 3;
+        const int consumers = 3;
+        const int perProducer = 20000;
+        MpmcQueue<int> q(64);
+        std::atomic<int> consumed{0};
+        std::vector<std::vector<int>> received(consumers);
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&q, p] {
+                for (int i = 0; i < perProducer; ++i)
+                    while (!q.TryEnqueue(p * perProducer + i)) std::this_thread::yield();
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&q, &consumed, &received, c] {
+                int value;
+                while (consumed.load() < producers * perProducer) {
+                    if (q.TryDequeue(value)) {
+                        received[c].push_back(value);
+                        consumed.fetch_add(1);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        std::vector<int> all;
+        for (auto& part : received) all.insert(all.end(), part.begin(), part.end());
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == static_cast<size_t>(producers * perProducer));
+        bool exact = true;
+        for (int i = 0; i < producers * perProducer; ++i)
+            exact = exact && all[i] == i;
+        REQUIRE(exact);
+        REQUIRE(q.IsEmpty());
+    }
+}
+
+TEST_CASE("ConcurrentQueue: Michael-Scott lock-free queue", "[Queue][ConcurrentQueue]") {
+    SECTION("Stands in for ListQueue in one thread") {
+        int raw[] = {10, 20, 30};
+        ConcurrentQueue<int> q(raw, 3);
+        Queue<int>& view = q;
+        REQUIRE(view.GetLength() == 3);
+        REQUIRE(view.Peek() == 10);
+        REQUIRE(view.GetLast() == 30);
+        REQUIRE(view.Dequeue() == 10);
+        REQUIRE(view.Get(0) == 20);
+        REQUIRE_THROWS_AS(view.Get(2), std::out_of_range);
+
+        view.Map([](int& x) { x += 1; });
+        view.Enqueue(40);
+        view.Where([](int& x) { return x % 2 == 1; });
+        REQUIRE(view.GetLength() == 2);
+        REQUIRE(view.Reduce([](const int& a, const int& b) { return a * b; }) == 651);
+        view.Enqueue(7); // хвост после Where указывает на последний оставшийся узел
+        REQUIRE(view.GetLast() == 7);
+
+        view.Clear();
+        REQUIRE(view.IsEmpty());
+        REQUIRE_THROWS_AS(view.Dequeue(), std::out_of_range);
+        REQUIRE_THROWS_AS(view.Peek(), std::out_of_range);
+
+        ConcurrentQueue<std::string> words;
+        for (int i = 0; i < 1000; ++i) words.Enqueue(std::to_string(i)); // узлы переиспользуются
+        for (int i = 0; i < 999; ++i) words.Dequeue();
+        REQUIRE(words.Dequeue() == "999");
+    }
+
+    SECTION("Producers and consumers keep per-producer order") {
+        const int producers = 3;
+        const int consumers = 3;
+        const int perProducer = 20000;
+        ConcurrentQueue<int> q;
+        std::atomic<int> consumed{0};
+        std::vector<std::vector<int>> received(consumers);
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&q, p] {
+                for (int i = 0; i < perProducer; ++i) q.Enqueue(p * perProducer + i);
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&q, &consumed, &received, c] {
+                int value;
+                while (consumed.load() < producers * perProducer) {
+                    if (q.TryDequeue(value)) {
+                        received[c].push_back(value);
+                        consumed.fetch_add(1);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        // У каждого потребителя значения одного производителя идут по возрастанию
+        bool fifo = true;
+        std::vector<int> all;
+        for (auto& part : received) {
+            std::vector<int> last(producers, -1);
+            for (int value : part) {
+                int p = value / perProducer;
+                fifo = fifo && value > last[p];
+                last[p] = value;
+            }
+            all.insert(all.end(), part.begin(), part.end());
+        }
+        REQUIRE(fifo);
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == static_cast<size_t>(producers * perProducer));
+        bool exact = true;
+        for (int i = 0; i < producers * perProducer; ++i)
+            exact = exact && all[i] == i;
+        REQUIRE(exact);
+        REQUIRE(q.IsEmpty());
+        REQUIRE(q.GetLength() == 0);
+    }
+}